@@ -69,6 +69,8 @@
 #define _IFT_Domain_numberOfSpatialDimensions "nsd" ///< [in,optional] Specifies how many spatial dimensions the domain has.
 #define _IFT_Domain_nfracman "nfracman" /// [in,optional] Specifies if there is a fracture manager.
 #define _IFT_Domain_axisymmetric "axisymm" /// [optional] Specifies if the problem is axisymmetric.
+#define _IFT_Domain_geometryCache "geomcache" /// [optional] Geometry cache level for small strain elements (0 - off, 1 - volumes, 2 - volumes and B-matrices).
+#define _IFT_Domain_geometryCacheLimit "geomcachelimit" /// [optional] Memory limit (in MB) for cached B-matrices, zero means unlimited.
 //@}
 
 namespace oofem {
@@ -85,6 +87,8 @@ class DofManager;
 class OutputManager;
 class EngngModel;
 class ConnectivityTable;
+class ElementAssemblyPlan;
+class ElementLocationTable;
 class ErrorEstimator;
 class SpatialLocalizer;
 class NodalRecoveryModel;
@@ -156,6 +160,14 @@ private:
      * Provides connectivity information of current domain.
      */
     std :: unique_ptr< ConnectivityTable > connectivityTable;
+    /**
+     * Order of the elements in the assembly loops. Built upon request, reset when the elements change.
+     */
+    std :: unique_ptr< ElementAssemblyPlan > elementAssemblyPlan;
+    /**
+     * Compiled location arrays of the elements. Built after the equations are numbered, reset when the dofs are renumbered.
+     */
+    std :: unique_ptr< ElementLocationTable > elementLocationTable;
     /**
      * Spatial Localizer. It is build upon request.
      * Provides the spatial localization services.
@@ -170,8 +182,16 @@ private:
     /// Number of spatial dimensions
     int nsd;
     bool axisymm;
+    /// Geometry cache level (0 - off, 1 - integration point volumes, 2 - volumes and B-matrices).
+    int geometryCacheMode;
+    /// Memory limit for cached B-matrices in bytes (zero means unlimited).
+    double geometryCacheLimit;
+    /// Memory currently reserved by cached B-matrices in bytes.
+    double geometryCacheUsed;
     /// nodal recovery object associated to receiver.
     std :: unique_ptr< NodalRecoveryModel > smoother; ///@todo I don't see why this has to be stored, and there is only one? /Mikael
+    /// Recovery models shared by export modules, indexed by recovery model type.
+    std :: map< int, std :: unique_ptr< NodalRecoveryModel > >sharedSmoothers;
 
     std :: string mDomainType;
     /**
@@ -451,6 +471,23 @@ public:
     int giveNumberOfSpatialDimensions();
     /// Returns true of axisymmetry is in effect.
     bool isAxisymmetric();
+    /**
+     * Returns the geometry cache level requested for small strain elements.
+     * Elements with geometry independent of the solution (nlgeo 0, no updated Lagrangian formulation)
+     * may keep integration point volumes (level 1) and also B-matrices (level 2) instead of recomputing them in every iteration.
+     */
+    int giveGeometryCacheMode() { return geometryCacheMode; }
+    /**
+     * Reserves memory for cached element geometry. Thread safe.
+     * @param bytes Requested size.
+     * @return False if the memory limit of the cache would be exceeded, in which case nothing is reserved.
+     */
+    bool reserveGeometryCacheMemory(double bytes);
+    /**
+     * Returns memory reserved for cached element geometry when the cache is dropped. Thread safe.
+     * @param bytes Size previously reserved by reserveGeometryCacheMemory.
+     */
+    void releaseGeometryCacheMemory(double bytes);
     /**
      * @name Advanced domain manipulation methods.
      */
@@ -605,10 +642,33 @@ public:
      * Returns receiver's associated connectivity table.
      */
     ConnectivityTable *giveConnectivityTable();
+    /**
+     * Returns the order in which the assembly loops visit the elements, grouping elements of the same type.
+     * The plan is built upon request and rebuilt after the element list changes.
+     */
+    ElementAssemblyPlan *giveElementAssemblyPlan();
+    /**
+     * Returns the compiled location arrays of the elements, NULL if the table is not available.
+     */
+    ElementLocationTable *giveElementLocationTable() { return elementLocationTable.get(); }
+    /**
+     * Builds the compiled location arrays of the elements from the current equation numbers.
+     * Called by the engineering model after the equations are numbered.
+     */
+    void buildElementLocationTable();
+    /**
+     * Discards the compiled location arrays of the elements, e.g. when the dofs are renumbered.
+     */
+    void clearElementLocationTable();
     /**
      * Returns receiver's associated spatial localizer.
      */
     SpatialLocalizer *giveSpatialLocalizer();
+    /**
+     * Discards the point locations cached by the spatial localizer (if any),
+     * e.g. when the elements change or the nodes move.
+     */
+    void clearPointLocationCache();
     /**
      * Returns domain output manager.
      */
@@ -633,6 +693,13 @@ public:
      * @param destroyOld Determines if any preexisting smoother should be deleted.
      */
     void setSmoother(NodalRecoveryModel *newSmoother, bool destroyOld = true);
+    /**
+     * Returns the recovery model of given type shared by all export modules of the receiver.
+     * Values recovered by one module are thus reused by the others in the same solution state.
+     * The model is created on first request.
+     * @param type Recovery model type (NodalRecoveryModel :: NodalRecoveryModelType).
+     */
+    NodalRecoveryModel *giveSharedSmoother(int type);
 
 #ifdef __PARALLEL_MODE
     /**@name Domain transaction support methods.
@@ -691,6 +691,8 @@ public:
     int giveMaterialNumber() const {return material;}
     /// @return Reference to the associated crossSection of element.
     CrossSection *giveCrossSection();
+    /// @return Cross section number.
+    int giveCrossSectionNumber() const { return crossSection; }
     /**
      * Sets the cross section model of receiver.
      * @param csIndx Index of new cross section.
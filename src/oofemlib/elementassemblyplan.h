@@ -0,0 +1,88 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef elementassemblyplan_h
+#define elementassemblyplan_h
+
+#include "oofemcfg.h"
+#include "intarray.h"
+
+#include <vector>
+
+namespace oofem {
+class Domain;
+
+/**
+ * Order in which the elements of a domain are visited by the assembly loops.
+ * Elements are grouped by their concrete class, interpolation and cross section, so consecutive elements
+ * of the loops run the same code (element, cross section and material methods) and share interpolation data,
+ * instead of alternating between element types in input order (e.g. solids, interfaces and reinforcement bars).
+ * Within a group, the elements keep their input order. Groups are ordered by the first element of each group.
+ * Elements of a group also agree on whether they have a rotation matrix (see Element::giveRotationMatrix), so the
+ * assembly loops evaluate and apply it only for the groups which need it.
+ *
+ * The plan is kept by the domain (see Domain::giveElementAssemblyPlan) and rebuilt when the elements change.
+ */
+class OOFEM_EXPORT ElementAssemblyPlan
+{
+public:
+    /// Consecutive elements of the plan sharing the element class, interpolation, cross section and rotation matrix presence.
+    struct Group {
+        /// Positions of the first and last element of the group in the plan.
+        int first, last;
+        /// True if the elements have a rotation matrix.
+        bool hasRotationMatrix;
+    };
+
+protected:
+    /// Element numbers ordered by groups.
+    IntArray elements;
+    /// Groups of the plan.
+    std :: vector< Group >groups;
+
+public:
+    ElementAssemblyPlan() : elements(), groups() { }
+
+    /// Builds the plan for the elements of the given domain.
+    void build(Domain *d);
+
+    /// Returns the number of elements in the plan.
+    int giveNumberOfElements() const { return elements.giveSize(); }
+    /// Returns the element numbers ordered by groups.
+    const IntArray &giveElements() const { return elements; }
+    /// Returns the groups of the plan.
+    const std :: vector< Group > &giveGroups() const { return groups; }
+};
+} // end namespace oofem
+#endif // elementassemblyplan_h
@@ -0,0 +1,108 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef elementlocationtable_h
+#define elementlocationtable_h
+
+#include "oofemcfg.h"
+#include "intarray.h"
+#include "floatmatrix.h"
+
+#include <vector>
+
+namespace oofem {
+class Domain;
+class Element;
+class UnknownNumberingScheme;
+
+/**
+ * Compiled location arrays of all elements of a domain.
+ * The equation numbers of the elements are stored in a flat table (compressed row storage, one row per element)
+ * for the default numberings of the engineering model (unknowns and prescribed unknowns),
+ * together with the master dof IDs and the transformations of the element dofs to the master dofs
+ * (slave dof weights and nodal coordinate systems).
+ * Evaluating the location arrays otherwise walks all dof managers and dofs of the element,
+ * following the slave dofs (e.g. of hanging nodes and rigid arm nodes) to their masters.
+ *
+ * The table is built by the engineering model after the equations are numbered (see EngngModel::forceEquationNumbering)
+ * and kept by the domain (see Domain::giveElementLocationTable). Any new numbering of the dofs discards it.
+ * Element::giveLocationArray and Element::giveRotationMatrix use the table when it is available,
+ * so all assemblers and the construction of sparse matrix profiles benefit from it.
+ * Other numbering schemes are always evaluated dof by dof.
+ */
+class OOFEM_EXPORT ElementLocationTable
+{
+protected:
+    /// Elements of the table, used to check that the element belongs to the tabulated domain.
+    std :: vector< const Element * >elements;
+    /// Position of the location array of each element in the table (0-based), followed by the size of the table.
+    IntArray offsets;
+    /// Equation numbers of unknowns.
+    IntArray equations;
+    /// Equation numbers of prescribed unknowns.
+    IntArray prescribedEquations;
+    /// Master dof IDs.
+    IntArray dofIDs;
+    /// Transformations of the element dofs to the master dofs, empty for elements without transformation.
+    std :: vector< FloatMatrix >dofTransformations;
+
+public:
+    ElementLocationTable() { }
+
+    /// Builds the table for the elements of the given domain, using the current equation numbers.
+    void build(Domain *d);
+
+    /**
+     * Gives the location array of the element from the table.
+     * @param answer Location array.
+     * @param elem Element.
+     * @param s Numbering scheme.
+     * @param dofIds Master dof IDs of the location array, if requested.
+     * @return False if the element or the numbering scheme are not tabulated, in which case answer is not set.
+     */
+    bool giveLocationArray(IntArray &answer, const Element *elem, const UnknownNumberingScheme &s, IntArray *dofIds = NULL) const;
+    /**
+     * Gives the transformation of the element dofs to the master dofs (see Element::computeDofTransformationMatrix).
+     * @param elem Element.
+     * @return Transformation matrix, empty if the element requires no transformation, or NULL if the element is not tabulated.
+     */
+    const FloatMatrix *giveDofTransformationMatrix(const Element *elem) const;
+
+protected:
+    /// Returns true if the element is part of the table.
+    bool isTabulated(const Element *elem) const;
+};
+} // end namespace oofem
+#endif // elementlocationtable_h
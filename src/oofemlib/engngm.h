@@ -959,6 +959,22 @@ public:
      */
     void assembleVectorFromElements(FloatArray &answer, TimeStep *tStep, const VectorAssembler &va, ValueModeType mode,
                                     const UnknownNumberingScheme &s, Domain *domain, FloatArray *eNorms = NULL);
+    /**
+     * Assembles the contributions of a single element (its characteristic vector, surface terms and element loads) into given vector.
+     * @param answer Assembled vector.
+     * @param element Element to assemble from.
+     * @param tStep Time step, when answer is assembled.
+     * @param va Determines what vector is assembled.
+     * @param mode Mode of unknown (total, incremental, rate of change).
+     * @param s Determines the equation numbering scheme.
+     * @param eNorms Norms for each dofid (optional).
+     * @param exclusive True if no other thread writes to the equations of the element at the same time (e.g. elements of one color),
+     * otherwise concurrent writes are serialized.
+     * @param hasRotationMatrix False if the element is known to have no rotation matrix (see ElementAssemblyPlan),
+     * its evaluation is then skipped.
+     */
+    void assembleVectorFromElement(FloatArray &answer, Element &element, TimeStep *tStep, const VectorAssembler &va, ValueModeType mode,
+                                   const UnknownNumberingScheme &s, FloatArray *eNorms, bool exclusive, bool hasRotationMatrix = true);
 
     /**
      * Assembles characteristic vector of required type from boundary conditions.
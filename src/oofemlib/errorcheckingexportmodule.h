@@ -146,6 +146,15 @@ public:
     virtual const char *giveClassName() const {return "LoadLevelErrorCheckingRule";}
 };
 
+/// Checks the number of iterations of the nonlinear solver
+class OOFEM_EXPORT NumberOfIterationsErrorCheckingRule : public ErrorCheckingRule
+{
+public:
+    NumberOfIterationsErrorCheckingRule(const std :: string &line, double tol);
+    virtual bool check(Domain *domain, TimeStep *tStep);
+    virtual const char *giveClassName() const {return "NumberOfIterationsErrorCheckingRule";}
+};
+
 /// Checks eigen value
 class OOFEM_EXPORT EigenValueErrorCheckingRule : public ErrorCheckingRule
 {
@@ -36,6 +36,7 @@
 #define fei2dquadbiquad_h
 
 #include "fei2dquadquad.h"
+#include "sumfactorization.h"
 
 namespace oofem {
 /**
@@ -54,7 +55,7 @@ namespace oofem {
  * @note Untested.
  * @author Mikael Öhman
  */
-class OOFEM_EXPORT FEI2dQuadBiQuad : public FEI2dQuadQuad
+class OOFEM_EXPORT FEI2dQuadBiQuad : public FEI2dQuadQuad, public FEITensorProduct
 {
 public:
     FEI2dQuadBiQuad(int ind1, int ind2) : FEI2dQuadQuad(ind1, ind2) { }
@@ -65,6 +66,11 @@ public:
     
     virtual IntegrationRule *giveIntegrationRule(int order);
 
+    // Tensor product structure
+    virtual int giveNumberOf1dFunctions() const { return 3; }
+    virtual void eval1dFunctions(FloatArray &N, FloatArray &dN, double xi) const;
+    virtual void giveTensorProductNodeOrdering(IntArray &answer) const;
+
 protected:
     virtual void giveDerivatives(FloatMatrix &answer, const FloatArray &lcoords);
 };
@@ -36,6 +36,8 @@
 #define fei2dquadlin_h
 
 #include "feinterpol2d.h"
+#include "floatarrayf.h"
+#include "floatmatrixf.h"
 
 namespace oofem {
 /**
@@ -58,6 +60,9 @@ public:
     // Bulk
     virtual void evalN(FloatArray &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
     virtual double evaldNdx(FloatMatrix &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
+    virtual void evaldNdxi(FloatMatrix &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo)
+    { this->giveDerivatives(answer, lcoords); }
+    virtual bool providesReferenceTables() const { return true; }
     virtual void local2global(FloatArray &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
     virtual int  global2local(FloatArray &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
     virtual void giveJacobianMatrixAt(FloatMatrix &jacobianMatrix, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
@@ -78,6 +83,20 @@ public:
 
 
     void giveDerivatives(FloatMatrix &dn, const FloatArray &lc);
+    /**
+     * Fixed size variant of giveDerivatives.
+     * @param lcoords Natural coordinates.
+     * @return Derivatives of shape functions with respect to natural coordinates (row per node).
+     */
+    static FloatMatrixF< 4, 2 >evaldNdxi(const FloatArrayF< 2 > &lcoords);
+    /**
+     * Fixed size variant of evaldNdx, intended for element kernels.
+     * @param answer Derivatives of shape functions with respect to global coordinates (row per node).
+     * @param lcoords Natural coordinates.
+     * @param cellgeo Underlying cell geometry.
+     * @return Determinant of the Jacobian.
+     */
+    double evaldNdx(FloatMatrixF< 4, 2 > &answer, const FloatArrayF< 2 > &lcoords, const FEICellGeometry &cellgeo) const;
 
 protected:
     double edgeComputeLength(IntArray &edgeNodes, const FEICellGeometry &cellgeo);
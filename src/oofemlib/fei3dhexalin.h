@@ -36,6 +36,8 @@
 #define fei3dhexalin_h
 
 #include "feinterpol3d.h"
+#include "floatarrayf.h"
+#include "floatmatrixf.h"
 
 namespace oofem {
 /**
@@ -55,6 +57,9 @@ public:
     // Bulk
     virtual void evalN(FloatArray &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
     virtual double evaldNdx(FloatMatrix &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
+    virtual void evaldNdxi(FloatMatrix &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo)
+    { this->giveLocalDerivative(answer, lcoords); }
+    virtual bool providesReferenceTables() const { return true; }
     virtual void local2global(FloatArray &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
     virtual int  global2local(FloatArray &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
     virtual int giveNumberOfNodes() const { return 8; }
@@ -86,6 +91,21 @@ public:
     virtual IntegrationRule *giveIntegrationRule(int order);
     virtual IntegrationRule *giveBoundaryIntegrationRule(int order, int boundary);
 
+    /**
+     * Fixed size variant of evaldNdxi.
+     * @param lcoords Natural coordinates.
+     * @return Derivatives of shape functions with respect to natural coordinates (row per node).
+     */
+    static FloatMatrixF< 8, 3 >evaldNdxi(const FloatArrayF< 3 > &lcoords);
+    /**
+     * Fixed size variant of evaldNdx, intended for element kernels.
+     * @param answer Derivatives of shape functions with respect to global coordinates (row per node).
+     * @param lcoords Natural coordinates.
+     * @param cellgeo Underlying cell geometry.
+     * @return Determinant of the Jacobian.
+     */
+    double evaldNdx(FloatMatrixF< 8, 3 > &answer, const FloatArrayF< 3 > &lcoords, const FEICellGeometry &cellgeo) const;
+
 protected:
     double edgeComputeLength(IntArray &edgeNodes, const FEICellGeometry &cellgeo);
     void giveLocalDerivative(FloatMatrix &dN, const FloatArray &lcoords);
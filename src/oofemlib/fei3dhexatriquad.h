@@ -36,13 +36,14 @@
 #define fei3dhexatriquad_h
 
 #include "fei3dhexaquad.h"
+#include "sumfactorization.h"
 
 namespace oofem {
 /**
  * Class representing implementation of tri-quadratic hexahedra interpolation class.
  * @author Mikael Öhman
  */
-class OOFEM_EXPORT FEI3dHexaTriQuad : public FEI3dHexaQuad
+class OOFEM_EXPORT FEI3dHexaTriQuad : public FEI3dHexaQuad, public FEITensorProduct
 {
 public:
     FEI3dHexaTriQuad() : FEI3dHexaQuad() { }
@@ -67,6 +68,11 @@ public:
     virtual IntegrationRule *giveIntegrationRule(int order);
     virtual IntegrationRule *giveBoundaryIntegrationRule(int order, int boundary);
 
+    // Tensor product structure
+    virtual int giveNumberOf1dFunctions() const { return 3; }
+    virtual void eval1dFunctions(FloatArray &N, FloatArray &dN, double xi) const;
+    virtual void giveTensorProductNodeOrdering(IntArray &answer) const;
+
 protected:
     virtual void giveLocalDerivative(FloatMatrix &dN, const FloatArray &lcoords);
 };
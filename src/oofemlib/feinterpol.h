@@ -47,6 +47,11 @@
 
 #include "fmode.h"
 #include "engngm.h"
+#include "floatarray.h"
+#include "floatmatrix.h"
+
+#include <vector>
+#include <list>
 
 namespace oofem {
 class Element;
@@ -54,6 +59,8 @@ class FloatArray;
 class FloatMatrix;
 class IntArray;
 class IntegrationRule;
+class GaussPoint;
+class FEInterpolation;
 
 /**
  * Class representing a general abstraction for cell geometry.
@@ -159,6 +166,27 @@ public:
     const FloatArray *giveVertexCoordinates(int i) const { return &this->coords [ i - 1 ]; }
 };
 
+/**
+ * Interpolation functions and their derivatives with respect to natural coordinates,
+ * tabulated in all points of an integration rule on the reference element.
+ * Tables are owned by the interpolation and shared by all integration rules with the same points,
+ * so that only the geometry dependent part has to be evaluated per element.
+ */
+class OOFEM_EXPORT FEIReferenceTable
+{
+public:
+    /// Interpolation which the table belongs to.
+    const FEInterpolation *interpolation;
+    /// Natural coordinates of the integration points.
+    std :: vector< FloatArray > lcoords;
+    /// Interpolation functions in the integration points.
+    std :: vector< FloatArray > N;
+    /// Derivatives of the interpolation functions w.r.t. natural coordinates in the integration points.
+    std :: vector< FloatMatrix > dNdxi;
+
+    FEIReferenceTable(const FEInterpolation *interp) : interpolation(interp) { }
+};
+
 /**
  * Class representing a general abstraction for finite element interpolation class.
  * The boundary functions denote the (numbered) region that have 1 spatial dimension (i.e. edges) or 2 spatial dimensions.
@@ -167,6 +195,8 @@ class OOFEM_EXPORT FEInterpolation
 {
 protected:
     int order;
+    /// Reference tables of the integration rules used with the receiver.
+    std :: list< FEIReferenceTable > referenceTables;
 
 public:
     FEInterpolation(int o) {
@@ -227,6 +257,41 @@ public:
     virtual void evaldNdxi(FloatMatrix &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo) {
         OOFEM_ERROR("not implemented");
     }
+    /**
+     * Returns true if the interpolation functions and their natural derivatives do not depend on the cell geometry
+     * and the mapping is isoparametric, so that they can be tabulated in the integration points of the reference element.
+     * Such interpolations implement evaldNdxi and evaldNdxFromNatural.
+     */
+    virtual bool providesReferenceTables() const { return false; }
+    /**
+     * Returns the reference table of the receiver for the integration rule of given integration point.
+     * The table is attached to the integration rule on first request.
+     * @return Table or NULL if the receiver or the rule does not support tabulation.
+     */
+    const FEIReferenceTable *giveReferenceTable(GaussPoint *gp);
+    /**
+     * Evaluates the array of interpolation functions at given integration point.
+     * Tabulated values are used when available, otherwise the same as evalN.
+     */
+    void evalNAt(FloatArray &answer, GaussPoint *gp, const FEICellGeometry &cellgeo);
+    /**
+     * Evaluates the matrix of derivatives of interpolation functions at given integration point.
+     * Tabulated natural derivatives are used when available, otherwise the same as evaldNdx.
+     * @return Determinant of the Jacobian.
+     */
+    double evaldNdxAt(FloatMatrix &answer, GaussPoint *gp, const FEICellGeometry &cellgeo);
+    /**
+     * Evaluates the derivatives of interpolation functions w.r.t. global coordinates
+     * from the derivatives w.r.t. natural coordinates, for isoparametric mapping.
+     * @param answer Derivatives w.r.t. global coordinates.
+     * @param dNdxi Derivatives w.r.t. natural coordinates.
+     * @param cellgeo Underlying cell geometry.
+     * @return Determinant of the Jacobian.
+     */
+    virtual double evaldNdxFromNatural(FloatMatrix &answer, const FloatMatrix &dNdxi, const FEICellGeometry &cellgeo) {
+        OOFEM_ERROR("not implemented");
+        return 0.;
+    }
     /**
      * Returns a matrix containing the local coordinates for each node corresponding to the interpolation
      */
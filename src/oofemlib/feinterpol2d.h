@@ -58,6 +58,8 @@ public:
      */
     virtual double giveArea(const FEICellGeometry &cellgeo) const;
 
+    virtual double evaldNdxFromNatural(FloatMatrix &answer, const FloatMatrix &dNdxi, const FEICellGeometry &cellgeo);
+
     /**@name Boundary interpolation services. 
        Boundary is defined as entity of one dimension lower
        than the interpolation represents
@@ -54,6 +54,8 @@ public:
      */
     virtual double giveVolume(const FEICellGeometry &cellgeo) const;
 
+    virtual double evaldNdxFromNatural(FloatMatrix &answer, const FloatMatrix &dNdxi, const FEICellGeometry &cellgeo);
+
     virtual void boundaryEdgeGiveNodes(IntArray &answer, int boundary);
     virtual void boundaryEdgeEvalN(FloatArray &answer, int boundary, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
     virtual double boundaryEdgeGiveTransformationJacobian(int boundary, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
@@ -47,6 +47,7 @@ namespace oofem {
 class IntArray;
 class FloatMatrix;
 class DataStream;
+template< std :: size_t N >class FloatArrayF;
 
 /**
  * Class representing vector of real numbers. This array can grow or shrink to
@@ -104,6 +105,9 @@ public:
     FloatArray(FloatArray &&src) : values(std::move(src.values)) { }
     /// Initializer list constructor.
     inline FloatArray(std :: initializer_list< double >list) : values(list) { }
+    /// Creates the array from a fixed size array.
+    template< std :: size_t N >
+    FloatArray(const FloatArrayF< N > &src) : values( src.begin(), src.end() ) { }
     /// Destructor.
     virtual ~FloatArray() {};
 
@@ -113,6 +117,9 @@ public:
     FloatArray &operator = (FloatArray &&src) { values = std::move(src.values); return *this; }
     /// Assignment operator.
     inline FloatArray &operator = (std :: initializer_list< double >list) { values = list; return *this; }
+    /// Assignment from a fixed size array, reuses the allocated space of the receiver.
+    template< std :: size_t N >
+    FloatArray &operator = (const FloatArrayF< N > &src) { values.assign( src.begin(), src.end() ); return *this; }
 
     /// Add one element
     void push_back(const double &iVal) {values.push_back(iVal);}
@@ -0,0 +1,231 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef floatarrayf_h
+#define floatarrayf_h
+
+#include "oofemcfg.h"
+#include "floatarray.h"
+#include "error.h"
+
+#include <array>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+namespace oofem {
+/**
+ * Class representing a vector of real numbers with size known at compile time.
+ * The values are stored on the stack, so the class is suited for temporaries in element and material kernels
+ * (strain and stress vectors, nodal coordinates etc.) where FloatArray would allocate memory on every call.
+ * Indexing follows FloatArray, i.e. at() is 1-based and operator() / operator[] are 0-based.
+ * FloatArray is implicitly constructible from the receiver, the opposite conversion is explicit and checks the size,
+ * which allows kernels to be migrated one by one.
+ *
+ * @see FloatMatrixF
+ */
+template< std :: size_t N >
+class FloatArrayF
+{
+protected:
+    /// Stored values.
+    std :: array< double, N >values;
+
+public:
+    /// @name Iterator for for-each loops:
+    //@{
+    double *begin() { return values.data(); }
+    double *end() { return values.data() + N; }
+    const double *begin() const { return values.data(); }
+    const double *end() const { return values.data() + N; }
+    //@}
+
+    /// Creates zero vector.
+    FloatArrayF() : values() { }
+    /// Creates vector from given values, the number of values must match the size.
+    template< typename ... V, class = typename std :: enable_if< sizeof ... ( V ) == N >::type >
+    FloatArrayF(V ... x) : values { { double(x) ... } } { }
+    /// Creates vector from dynamic array of the same size.
+    explicit FloatArrayF(const FloatArray &src)
+    {
+#ifdef DEBUG
+        if ( src.giveSize() != ( int ) N ) {
+            OOFEM_ERROR("Can't convert dynamic array of size %d to fixed size %d", src.giveSize(), ( int ) N);
+        }
+#endif
+        std :: copy(src.begin(), src.end(), values.begin());
+    }
+
+    /// Returns the size of the receiver.
+    static constexpr int giveSize() { return N; }
+
+    /// Coefficient access function, 1-based indexing.
+    double &at(int i) { return values [ i - 1 ]; }
+    /// Coefficient access function, 1-based indexing.
+    double at(int i) const { return values [ i - 1 ]; }
+    /// Coefficient access function, 0-based indexing.
+    double &operator() (int i) { return values [ i ]; }
+    /// Coefficient access function, 0-based indexing.
+    double operator() (int i) const { return values [ i ]; }
+    /// Coefficient access function, 0-based indexing.
+    double &operator[] (int i) { return values [ i ]; }
+    /// Coefficient access function, 0-based indexing.
+    double operator[] (int i) const { return values [ i ]; }
+
+    /// Returns pointer to the first value.
+    double *givePointer() { return values.data(); }
+    /// Returns pointer to the first value.
+    const double *givePointer() const { return values.data(); }
+
+    /// Zeroes all coefficients of the receiver.
+    void zero() { values.fill(0.); }
+
+    FloatArrayF &operator += ( const FloatArrayF &x )
+    {
+        for ( std :: size_t i = 0; i < N; ++i ) {
+            values [ i ] += x [ i ];
+        }
+        return * this;
+    }
+
+    FloatArrayF &operator -= ( const FloatArrayF &x )
+    {
+        for ( std :: size_t i = 0; i < N; ++i ) {
+            values [ i ] -= x [ i ];
+        }
+        return * this;
+    }
+
+    FloatArrayF &operator *= ( double a )
+    {
+        for ( auto &v : values ) {
+            v *= a;
+        }
+        return * this;
+    }
+
+    /// Prints the receiver on screen.
+    void printYourself(const std :: string &name = "FloatArrayF") const
+    {
+        std :: cout << name << " (" << N << "): \n";
+        for ( double v : values ) {
+            std :: cout << v << "  ";
+        }
+        std :: cout << "\n";
+    }
+};
+
+template< std :: size_t N >
+FloatArrayF< N >operator + ( const FloatArrayF< N > &x, const FloatArrayF< N > &y )
+{
+    FloatArrayF< N >answer(x);
+    return answer += y;
+}
+
+template< std :: size_t N >
+FloatArrayF< N >operator - ( const FloatArrayF< N > &x, const FloatArrayF< N > &y )
+{
+    FloatArrayF< N >answer(x);
+    return answer -= y;
+}
+
+template< std :: size_t N >
+FloatArrayF< N >operator - ( const FloatArrayF< N > &x )
+{
+    FloatArrayF< N >answer(x);
+    return answer *= -1.;
+}
+
+template< std :: size_t N >
+FloatArrayF< N >operator *( double a, const FloatArrayF< N > &x )
+{
+    FloatArrayF< N >answer(x);
+    return answer *= a;
+}
+
+template< std :: size_t N >
+FloatArrayF< N >operator *( const FloatArrayF< N > &x, double a )
+{
+    return a * x;
+}
+
+/// Computes the dot product of two vectors.
+template< std :: size_t N >
+double dot(const FloatArrayF< N > &x, const FloatArrayF< N > &y)
+{
+    double answer = 0.;
+    for ( std :: size_t i = 0; i < N; ++i ) {
+        answer += x [ i ] * y [ i ];
+    }
+    return answer;
+}
+
+/// Computes the square of the Euclidean norm.
+template< std :: size_t N >
+double norm_square(const FloatArrayF< N > &x)
+{
+    return dot(x, x);
+}
+
+/// Computes the Euclidean norm.
+template< std :: size_t N >
+double norm(const FloatArrayF< N > &x)
+{
+    return std :: sqrt( norm_square(x) );
+}
+
+/// Computes the sum of all coefficients.
+template< std :: size_t N >
+double sum(const FloatArrayF< N > &x)
+{
+    double answer = 0.;
+    for ( double v : x ) {
+        answer += v;
+    }
+    return answer;
+}
+
+/// Computes the cross product of two 3d vectors.
+inline FloatArrayF< 3 >cross(const FloatArrayF< 3 > &x, const FloatArrayF< 3 > &y)
+{
+    return {
+        x [ 1 ] * y [ 2 ] - x [ 2 ] * y [ 1 ],
+        x [ 2 ] * y [ 0 ] - x [ 0 ] * y [ 2 ],
+        x [ 0 ] * y [ 1 ] - x [ 1 ] * y [ 0 ]
+    };
+}
+} // end namespace oofem
+#endif // floatarrayf_h
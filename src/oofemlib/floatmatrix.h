@@ -64,6 +64,7 @@ namespace oofem {
 class FloatArray;
 class IntArray;
 class DataStream;
+template< std :: size_t R, std :: size_t C >class FloatMatrixF;
 
 /**
  * Implementation of matrix containing floating point numbers. FloatMatrix can grow and shrink
@@ -125,6 +126,9 @@ public:
     FloatMatrix(FloatMatrix && mat) : nRows(mat.nRows), nColumns(mat.nColumns), values( std :: move(mat.values) ) {}
     /// Initializer list constructor.
     FloatMatrix(std :: initializer_list< std :: initializer_list< double > >mat);
+    /// Creates the matrix from a fixed size matrix.
+    template< std :: size_t R, std :: size_t C >
+    FloatMatrix(const FloatMatrixF< R, C > &src) : nRows(R), nColumns(C), values( src.begin(), src.end() ) {}
     /// Assignment operator.
     FloatMatrix &operator=(std :: initializer_list< std :: initializer_list< double > >mat);
     /// Assignment operator.
@@ -136,6 +140,14 @@ public:
         values = mat.values;
         return * this;
     }
+    /// Assignment from a fixed size matrix, reuses the allocated space of the receiver.
+    template< std :: size_t R, std :: size_t C >
+    FloatMatrix &operator=(const FloatMatrixF< R, C > &src) {
+        nRows = R;
+        nColumns = C;
+        values.assign( src.begin(), src.end() );
+        return * this;
+    }
     FloatMatrix &operator=(FloatMatrix && mat) {
         nRows = std :: move(mat.nRows);
         nColumns = std :: move(mat.nColumns);
@@ -0,0 +1,379 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef floatmatrixf_h
+#define floatmatrixf_h
+
+#include "oofemcfg.h"
+#include "floatarrayf.h"
+#include "floatmatrix.h"
+#include "error.h"
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+namespace oofem {
+/**
+ * Class representing a real matrix with dimensions known at compile time.
+ * The values are stored column wise on the stack, in the same layout as FloatMatrix, so that
+ * B-matrices, Jacobians and material tangents of element and material kernels avoid heap allocations.
+ * Indexing follows FloatMatrix, i.e. at() is 1-based and operator() is 0-based.
+ * FloatMatrix is implicitly constructible from the receiver, the opposite conversion is explicit and checks the size.
+ *
+ * @see FloatArrayF
+ */
+template< std :: size_t R, std :: size_t C >
+class FloatMatrixF
+{
+protected:
+    /// Values of matrix stored column wise.
+    std :: array< double, R * C >values;
+
+public:
+    /// @name Iterator over the column wise stored values:
+    //@{
+    double *begin() { return values.data(); }
+    double *end() { return values.data() + R * C; }
+    const double *begin() const { return values.data(); }
+    const double *end() const { return values.data() + R * C; }
+    //@}
+
+    /// Creates zero matrix.
+    FloatMatrixF() : values() { }
+    /// Creates matrix from values given row by row (as the matrix would be written on paper).
+    template< typename ... V, class = typename std :: enable_if< sizeof ... ( V ) == R * C >::type >
+    FloatMatrixF(V ... x) : values()
+    {
+        const double rowWise [] = {
+            double(x) ...
+        };
+        for ( std :: size_t i = 0; i < R; ++i ) {
+            for ( std :: size_t j = 0; j < C; ++j ) {
+                ( * this )( i, j ) = rowWise [ i * C + j ];
+            }
+        }
+    }
+    /// Creates matrix from dynamic matrix of the same size.
+    explicit FloatMatrixF(const FloatMatrix &src)
+    {
+#ifdef DEBUG
+        if ( src.giveNumberOfRows() != ( int ) R || src.giveNumberOfColumns() != ( int ) C ) {
+            OOFEM_ERROR("Can't convert dynamic matrix of size %dx%d to fixed size %dx%d",
+                        src.giveNumberOfRows(), src.giveNumberOfColumns(), ( int ) R, ( int ) C);
+        }
+#endif
+        std :: copy(src.givePointer(), src.givePointer() + R * C, values.begin());
+    }
+
+    /// Returns number of rows of receiver.
+    static constexpr int giveNumberOfRows() { return R; }
+    /// Returns number of columns of receiver.
+    static constexpr int giveNumberOfColumns() { return C; }
+
+    /// Coefficient access function, 1-based indexing.
+    double &at(int i, int j) { return values [ ( j - 1 ) * R + i - 1 ]; }
+    /// Coefficient access function, 1-based indexing.
+    double at(int i, int j) const { return values [ ( j - 1 ) * R + i - 1 ]; }
+    /// Coefficient access function, 0-based indexing.
+    double &operator() (int i, int j) { return values [ j * R + i ]; }
+    /// Coefficient access function, 0-based indexing.
+    double operator() (int i, int j) const { return values [ j * R + i ]; }
+
+    /// Returns pointer to the first value.
+    double *givePointer() { return values.data(); }
+    /// Returns pointer to the first value.
+    const double *givePointer() const { return values.data(); }
+
+    /// Zeroes all coefficients of the receiver.
+    void zero() { values.fill(0.); }
+
+    /// Returns column j (0-based) of the receiver.
+    FloatArrayF< R >column(int j) const
+    {
+        FloatArrayF< R >answer;
+        for ( std :: size_t i = 0; i < R; ++i ) {
+            answer [ i ] = ( * this )( i, j );
+        }
+        return answer;
+    }
+
+    /// Returns row i (0-based) of the receiver.
+    FloatArrayF< C >row(int i) const
+    {
+        FloatArrayF< C >answer;
+        for ( std :: size_t j = 0; j < C; ++j ) {
+            answer [ j ] = ( * this )( i, j );
+        }
+        return answer;
+    }
+
+    /// Sets column j (0-based) of the receiver.
+    void setColumn(const FloatArrayF< R > &x, int j)
+    {
+        for ( std :: size_t i = 0; i < R; ++i ) {
+            ( * this )( i, j ) = x [ i ];
+        }
+    }
+
+    FloatMatrixF &operator += ( const FloatMatrixF &x )
+    {
+        for ( std :: size_t i = 0; i < R * C; ++i ) {
+            values [ i ] += x.values [ i ];
+        }
+        return * this;
+    }
+
+    FloatMatrixF &operator -= ( const FloatMatrixF &x )
+    {
+        for ( std :: size_t i = 0; i < R * C; ++i ) {
+            values [ i ] -= x.values [ i ];
+        }
+        return * this;
+    }
+
+    FloatMatrixF &operator *= ( double a )
+    {
+        for ( auto &v : values ) {
+            v *= a;
+        }
+        return * this;
+    }
+
+    /// Prints the receiver on screen.
+    void printYourself(const std :: string &name = "FloatMatrixF") const
+    {
+        std :: cout << name << " (" << R << " x " << C << "): \n";
+        for ( std :: size_t i = 0; i < R; ++i ) {
+            for ( std :: size_t j = 0; j < C; ++j ) {
+                std :: cout << ( * this )( i, j ) << "  ";
+            }
+            std :: cout << "\n";
+        }
+    }
+};
+
+template< std :: size_t R, std :: size_t C >
+FloatMatrixF< R, C >operator + ( const FloatMatrixF< R, C > &a, const FloatMatrixF< R, C > &b )
+{
+    FloatMatrixF< R, C >answer(a);
+    return answer += b;
+}
+
+template< std :: size_t R, std :: size_t C >
+FloatMatrixF< R, C >operator - ( const FloatMatrixF< R, C > &a, const FloatMatrixF< R, C > &b )
+{
+    FloatMatrixF< R, C >answer(a);
+    return answer -= b;
+}
+
+template< std :: size_t R, std :: size_t C >
+FloatMatrixF< R, C >operator *( double x, const FloatMatrixF< R, C > &a )
+{
+    FloatMatrixF< R, C >answer(a);
+    return answer *= x;
+}
+
+template< std :: size_t R, std :: size_t C >
+FloatMatrixF< R, C >operator *( const FloatMatrixF< R, C > &a, double x )
+{
+    return x * a;
+}
+
+/// Returns the identity matrix.
+template< std :: size_t N >
+FloatMatrixF< N, N >eye()
+{
+    FloatMatrixF< N, N >answer;
+    for ( std :: size_t i = 0; i < N; ++i ) {
+        answer(i, i) = 1.;
+    }
+    return answer;
+}
+
+/// Returns the transposed matrix.
+template< std :: size_t R, std :: size_t C >
+FloatMatrixF< C, R >transpose(const FloatMatrixF< R, C > &a)
+{
+    FloatMatrixF< C, R >answer;
+    for ( std :: size_t i = 0; i < R; ++i ) {
+        for ( std :: size_t j = 0; j < C; ++j ) {
+            answer(j, i) = a(i, j);
+        }
+    }
+    return answer;
+}
+
+/// Computes @f$ a x @f$.
+template< std :: size_t R, std :: size_t C >
+FloatArrayF< R >dot(const FloatMatrixF< R, C > &a, const FloatArrayF< C > &x)
+{
+    FloatArrayF< R >answer;
+    for ( std :: size_t j = 0; j < C; ++j ) {
+        double xj = x [ j ];
+        for ( std :: size_t i = 0; i < R; ++i ) {
+            answer [ i ] += a(i, j) * xj;
+        }
+    }
+    return answer;
+}
+
+/// Computes @f$ a^{\mathrm{T}} x @f$.
+template< std :: size_t R, std :: size_t C >
+FloatArrayF< C >Tdot(const FloatMatrixF< R, C > &a, const FloatArrayF< R > &x)
+{
+    FloatArrayF< C >answer;
+    for ( std :: size_t j = 0; j < C; ++j ) {
+        double sum = 0.;
+        for ( std :: size_t i = 0; i < R; ++i ) {
+            sum += a(i, j) * x [ i ];
+        }
+        answer [ j ] = sum;
+    }
+    return answer;
+}
+
+/// Computes @f$ a b @f$.
+template< std :: size_t R, std :: size_t K, std :: size_t C >
+FloatMatrixF< R, C >dot(const FloatMatrixF< R, K > &a, const FloatMatrixF< K, C > &b)
+{
+    FloatMatrixF< R, C >answer;
+    for ( std :: size_t j = 0; j < C; ++j ) {
+        for ( std :: size_t k = 0; k < K; ++k ) {
+            double bkj = b(k, j);
+            for ( std :: size_t i = 0; i < R; ++i ) {
+                answer(i, j) += a(i, k) * bkj;
+            }
+        }
+    }
+    return answer;
+}
+
+/// Computes @f$ a^{\mathrm{T}} b @f$.
+template< std :: size_t K, std :: size_t R, std :: size_t C >
+FloatMatrixF< R, C >Tdot(const FloatMatrixF< K, R > &a, const FloatMatrixF< K, C > &b)
+{
+    FloatMatrixF< R, C >answer;
+    for ( std :: size_t j = 0; j < C; ++j ) {
+        for ( std :: size_t i = 0; i < R; ++i ) {
+            double sum = 0.;
+            for ( std :: size_t k = 0; k < K; ++k ) {
+                sum += a(k, i) * b(k, j);
+            }
+            answer(i, j) = sum;
+        }
+    }
+    return answer;
+}
+
+/// Computes @f$ a b^{\mathrm{T}} @f$.
+template< std :: size_t R, std :: size_t K, std :: size_t C >
+FloatMatrixF< R, C >dotT(const FloatMatrixF< R, K > &a, const FloatMatrixF< C, K > &b)
+{
+    FloatMatrixF< R, C >answer;
+    for ( std :: size_t k = 0; k < K; ++k ) {
+        for ( std :: size_t j = 0; j < C; ++j ) {
+            double bjk = b(j, k);
+            for ( std :: size_t i = 0; i < R; ++i ) {
+                answer(i, j) += a(i, k) * bjk;
+            }
+        }
+    }
+    return answer;
+}
+
+/// Computes the dyadic product @f$ x y^{\mathrm{T}} @f$.
+template< std :: size_t R, std :: size_t C >
+FloatMatrixF< R, C >dyad(const FloatArrayF< R > &x, const FloatArrayF< C > &y)
+{
+    FloatMatrixF< R, C >answer;
+    for ( std :: size_t j = 0; j < C; ++j ) {
+        for ( std :: size_t i = 0; i < R; ++i ) {
+            answer(i, j) = x [ i ] * y [ j ];
+        }
+    }
+    return answer;
+}
+
+/// Computes @f$ b^{\mathrm{T}} a b @f$, typically the element stiffness contribution of a single integration point.
+template< std :: size_t N, std :: size_t M >
+FloatMatrixF< M, M >rotate(const FloatMatrixF< N, N > &a, const FloatMatrixF< N, M > &b)
+{
+    return Tdot( b, dot(a, b) );
+}
+
+/// Returns the determinant of a 2x2 matrix.
+inline double det(const FloatMatrixF< 2, 2 > &a)
+{
+    return a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0);
+}
+
+/// Returns the determinant of a 3x3 matrix.
+inline double det(const FloatMatrixF< 3, 3 > &a)
+{
+    return a(0, 0) * ( a(1, 1) * a(2, 2) - a(1, 2) * a(2, 1) ) -
+           a(0, 1) * ( a(1, 0) * a(2, 2) - a(1, 2) * a(2, 0) ) +
+           a(0, 2) * ( a(1, 0) * a(2, 1) - a(1, 1) * a(2, 0) );
+}
+
+/// Returns the inverse of a 2x2 matrix. Singularity is not checked, as in FloatMatrix::beInverseOf.
+inline FloatMatrixF< 2, 2 >inv(const FloatMatrixF< 2, 2 > &a)
+{
+    double d = det(a);
+    return {
+        a(1, 1) / d, -a(0, 1) / d,
+        -a(1, 0) / d, a(0, 0) / d
+    };
+}
+
+/// Returns the inverse of a 3x3 matrix. Singularity is not checked, as in FloatMatrix::beInverseOf.
+inline FloatMatrixF< 3, 3 >inv(const FloatMatrixF< 3, 3 > &a)
+{
+    double d = det(a);
+    return {
+        ( a(1, 1) * a(2, 2) - a(1, 2) * a(2, 1) ) / d,
+        ( a(0, 2) * a(2, 1) - a(0, 1) * a(2, 2) ) / d,
+        ( a(0, 1) * a(1, 2) - a(0, 2) * a(1, 1) ) / d,
+        ( a(1, 2) * a(2, 0) - a(1, 0) * a(2, 2) ) / d,
+        ( a(0, 0) * a(2, 2) - a(0, 2) * a(2, 0) ) / d,
+        ( a(0, 2) * a(1, 0) - a(0, 0) * a(1, 2) ) / d,
+        ( a(1, 0) * a(2, 1) - a(1, 1) * a(2, 0) ) / d,
+        ( a(0, 1) * a(2, 0) - a(0, 0) * a(2, 1) ) / d,
+        ( a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0) ) / d
+    };
+}
+} // end namespace oofem
+#endif // floatmatrixf_h
@@ -38,6 +38,8 @@
 #include "feinterpol.h"
 #include "floatarray.h"
 
+#include <vector>
+
 ///@name Input fields for BSplineInterpolation
 //@{
 #define _IFT_BSplineInterpolation_degree "degree"
@@ -53,6 +55,7 @@ namespace oofem {
 class FloatMatrix;
 class FloatArray;
 class IntArray;
+class IGAIntegrationElement;
 
 /**
  * Interpolation for B-splines.
@@ -195,6 +198,13 @@ public:
     virtual void giveJacobianMatrixAt(FloatMatrix &jacobianMatrix, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
     virtual int giveKnotSpanBasisFuncMask(const IntArray &knotSpan, IntArray &mask);
     virtual int giveNumberOfKnotSpanBasisFunctions(const IntArray &knotSpan);
+    /**
+     * Tabulates the nonzero one-dimensional basis functions and their first derivatives at the integration points
+     * of given integration element. The table is used whenever the receiver is evaluated at one of these points
+     * through FEIIGAElementGeometryWrapper constructed with the integration point.
+     * @param iRule Integration element with the integration points set up in the knot span coordinates.
+     */
+    virtual void tabulateBasisFunctions(IGAIntegrationElement &iRule);
 
     virtual const char *giveClassName() const { return "BSplineInterpolation"; }
     virtual bool hasSubPatchFormulation() { return true; }
@@ -257,6 +267,19 @@ protected:
      * @warning Parameter u must be in a valid range.
      */
     int findSpan(int n, int p, double u, const double *U) const;
+    /**
+     * Gives the knot span and the nonzero one-dimensional basis functions in each direction at given point.
+     * The tabulated values are used if cellgeo refers to an integration point of a tabulated integration element.
+     * @param span Knot span indices (zero based).
+     * @param N Nonzero basis functions in each direction.
+     * @param lcoords Parametric coordinates.
+     * @param cellgeo Element geometry (FEIIGAElementGeometryWrapper).
+     */
+    void giveKnotSpanBasisFuncs(IntArray &span, std :: vector< FloatArray > &N, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
+    /**
+     * Same as giveKnotSpanBasisFuncs, but gives the values (row 0) and the first derivatives (row 1) of the basis functions.
+     */
+    void giveKnotSpanBasisFuncDers(IntArray &span, std :: vector< FloatMatrix > &ders, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
     /**
      * Returns the range of nonzero basis functions for given knot span and given degree.
      */
@@ -85,6 +85,8 @@ public:
 
     virtual int giveKnotSpanBasisFuncMask(const IntArray &knotSpan, IntArray &mask);
     virtual int giveNumberOfKnotSpanBasisFunctions(const IntArray &knotSpan);
+    /// Basis functions of T-splines are defined by local knot vectors and are not tabulated.
+    virtual void tabulateBasisFunctions(IGAIntegrationElement &iRule) { }
 
     const char *giveClassName() const { return "TSplineInterpolation"; }
 
@@ -39,6 +39,9 @@
 #include "intarray.h"
 #include "feinterpol.h"
 #include "gaussintegrationrule.h"
+#include "gausspoint.h"
+
+#include <vector>
 
 ///@name Input fields for IGAElement
 //@{
@@ -59,14 +62,23 @@ class OOFEM_EXPORT FEIIGAElementGeometryWrapper : public FEICellGeometry
 public:
     const IntArray *knotSpan;
     Element *elem;
+    /// Integration point being evaluated, if any; allows the use of the basis functions tabulated by its integration element.
+    GaussPoint *gp;
 public:
     FEIIGAElementGeometryWrapper(Element * _elem, const IntArray * _knotSpan) : FEICellGeometry() {
         this->elem = _elem;
         this->knotSpan = _knotSpan;
+        this->gp = NULL;
+    }
+    FEIIGAElementGeometryWrapper(Element * _elem, GaussPoint * _gp) : FEICellGeometry() {
+        this->elem = _elem;
+        this->knotSpan = _gp->giveIntegrationRule()->giveKnotSpan();
+        this->gp = _gp;
     }
     FEIIGAElementGeometryWrapper(Element * _elem) : FEICellGeometry() {
         this->elem = _elem;
         this->knotSpan = NULL;
+        this->gp = NULL;
     }
 
     int giveNumberOfVertices() const { return elem->giveNumberOfNodes(); }
@@ -76,17 +88,69 @@ public:
 
 /**
  * IntegrationElement represent nonzero knot span, derived from Integration Rule.
+ * The integration element may hold a table of the one-dimensional basis functions of the interpolation
+ * at its integration points (see BSplineInterpolation :: tabulateBasisFunctions). Since the knot span is fixed,
+ * the table is set up once and then only read, so it may be shared by concurrent evaluations.
  */
 class OOFEM_EXPORT IGAIntegrationElement : public GaussIntegrationRule
 {
 protected:
     IntArray knotSpan;     // knot_span(nsd)
+    /**
+     * Values (row 0) and first derivatives (row 1) of the nonzero one-dimensional basis functions,
+     * one matrix for each distinct coordinate of the integration points in each direction [nsd][ncoords].
+     */
+    std :: vector< std :: vector< FloatMatrix > >basisTable;
+    /// Position of the coordinates of each integration point in basisTable, (gp - 1) * nsd + dir.
+    IntArray basisTableIndex;
+
 public:
     IGAIntegrationElement(int _n, Element * _e, IntArray & _knotSpan) :
         GaussIntegrationRule(_n, _e, 0, 0, false),
         knotSpan(_knotSpan) { }
     const IntArray *giveKnotSpan() { return & this->knotSpan; }
     void setKnotSpan1(IntArray &src) { this->knotSpan = src; }
+
+    /**
+     * Stores the table of one-dimensional basis functions.
+     * @param table Values and derivatives for each distinct coordinate in each direction.
+     * @param index Position of the coordinates of each integration point in the table.
+     */
+    void setBasisTable(std :: vector< std :: vector< FloatMatrix > > &table, const IntArray &index) {
+        this->basisTable.swap(table);
+        this->basisTableIndex = index;
+    }
+    /// Removes the table. Called whenever the integration points are set up again.
+    void clearBasisTable() {
+        this->basisTable.clear();
+        this->basisTableIndex.clear();
+    }
+
+    virtual int SetUpPointsOnLine(int nPoints, MaterialMode mode) {
+        this->clearBasisTable();
+        return GaussIntegrationRule :: SetUpPointsOnLine(nPoints, mode);
+    }
+    virtual int SetUpPointsOnSquare(int nPoints, MaterialMode mode) {
+        this->clearBasisTable();
+        return GaussIntegrationRule :: SetUpPointsOnSquare(nPoints, mode);
+    }
+    virtual int SetUpPointsOnCube(int nPoints, MaterialMode mode) {
+        this->clearBasisTable();
+        return GaussIntegrationRule :: SetUpPointsOnCube(nPoints, mode);
+    }
+    /**
+     * Gives the tabulated one-dimensional basis functions at given integration point.
+     * @param gp Integration point number.
+     * @param dir Direction (zero based).
+     * @return Values (row 0) and first derivatives (row 1), NULL if not tabulated.
+     */
+    const FloatMatrix *giveBasisDerivatives(int gp, int dir) const {
+        int nsd = ( int ) basisTable.size();
+        if ( dir >= nsd || gp < 1 || gp * nsd > basisTableIndex.giveSize() ) {
+            return NULL;
+        }
+        return & basisTable [ dir ] [ basisTableIndex.at( ( gp - 1 ) * nsd + dir + 1 ) ];
+    }
 };
 
 
@@ -43,12 +43,15 @@
 #include "inputrecord.h"
 
 #include <cstdio>
+#include <vector>
 
 namespace oofem {
 class TimeStep;
 class GaussPoint;
 class Element;
 class DataStream;
+class FEInterpolation;
+class FEIReferenceTable;
 
 ///@todo Breaks modularity, reconsider this;
 enum IntegrationRuleType {
@@ -118,6 +121,9 @@ protected:
     /// Activation flag
     bool isActivatedFlag; 
 
+    /// Reference tables of interpolation functions attached to receiver, owned by the interpolations.
+    std :: vector< const FEIReferenceTable * > referenceTables;
+
 public:
     std::vector< GaussPoint *> :: iterator begin() { return gaussPoints.begin(); }
     std::vector< GaussPoint *> :: iterator end() { return gaussPoints.end(); }
@@ -208,6 +214,16 @@ public:
     int giveNumber() { return this->number; }
     /** Returns the domain for the receiver */
     integrationDomain giveIntegrationDomain() const { return this->intdomain; }
+
+    /**
+     * Returns the reference table of given interpolation attached to receiver, NULL if none.
+     * @see FEInterpolation::giveReferenceTable
+     */
+    const FEIReferenceTable *giveReferenceTable(const FEInterpolation *interp) const;
+    /// Attaches the reference table to receiver, the table is dropped when the points of the receiver are cleared.
+    void attachReferenceTable(const FEIReferenceTable *table) { referenceTables.push_back(table); }
+    /// Returns true if the points of receiver can change during the computation.
+    bool isDynamicRule() const { return isDynamic; }
     /**
      * Abstract service.
      * Returns required number of integration points to exactly integrate
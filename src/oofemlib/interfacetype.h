@@ -89,7 +89,9 @@ enum InterfaceType {
     MicromorphicMaterialExtensionInterfaceType,
     SecondGradientMaterialExtensionInterfaceType,
 
-    MixedPressureMaterialExtensionInterfaceType
+    MixedPressureMaterialExtensionInterfaceType,
+
+    SumFactorizedElementInterfaceType
     
 
 };
@@ -0,0 +1,203 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef materialstatestorage_h
+#define materialstatestorage_h
+
+#include "oofemcfg.h"
+
+#include <vector>
+#include <memory>
+
+namespace oofem {
+/**
+ * Contiguous storage of the history variables of all integration points of a material region.
+ * Every point holds a fixed number of scalar values, each of them in a committed (equilibrated)
+ * and a temporary version. The points are stored in blocks, inside a block the values are stored
+ * as a structure of arrays, i.e. the same variable of consecutive points is contiguous.
+ *
+ * The committed and temporary versions are double buffered. Committing the temporary state
+ * of a point only flips the buffer index, initializing the temporary state only marks it as
+ * invalid, in which case it reads the committed values. The committed values are copied
+ * on the first write to the temporary state.
+ *
+ * Points are allocated when the material statuses are created and released when the statuses
+ * are deleted, released points are reused by later allocations. Blocks are kept in fixed-size
+ * segments, so that allocating a point never moves the blocks of other points; the values of
+ * different points may therefore be accessed concurrently, also while other points are allocated.
+ */
+class OOFEM_EXPORT MaterialStateStorage
+{
+public:
+    /// Number of points in one block.
+    static const int BlockSize = 64;
+    /// Number of blocks in one segment.
+    static const int SegmentSize = 1024;
+    /// Maximal number of segments.
+    static const int MaxSegments = 1024;
+
+protected:
+    /// Point data block.
+    struct Block {
+        /// Values, indexed as [buffer][value][point].
+        std :: unique_ptr< double[] >values;
+        /// Buffer index of committed state of each point, bit 1 is set when temporary state is valid.
+        unsigned char flags [ BlockSize ];
+    };
+
+    /// Number of values of each point.
+    int nValues;
+    /// Number of points ever allocated, including released ones.
+    int nPoints;
+    /// Segments of data blocks, allocated when first needed and never moved.
+    std :: unique_ptr< Block[] >segments [ MaxSegments ];
+    /// Released points available for reuse.
+    std :: vector< int >freePoints;
+
+    Block &giveBlock(int point) const
+    {
+        int block = point / BlockSize;
+        return segments [ block / SegmentSize ] [ block % SegmentSize ];
+    }
+    double *giveValue(int buffer, int point, int value) const
+    {
+        return & giveBlock(point).values [ ( buffer * nValues + value ) * BlockSize + point % BlockSize ];
+    }
+    unsigned char &giveFlags(int point) const { return giveBlock(point).flags [ point % BlockSize ]; }
+    /// Copies committed values into temporary buffer and marks it as valid.
+    void validateTemp(int point);
+
+public:
+    /**
+     * Constructor.
+     * @param nValues Number of values stored for each point.
+     */
+    MaterialStateStorage(int nValues);
+
+    /// Returns number of values stored for each point.
+    int giveNumberOfValues() const { return nValues; }
+    /// Returns number of allocated points, not counting released ones.
+    int giveNumberOfPoints() const { return nPoints - ( int ) freePoints.size(); }
+
+    /**
+     * Allocates a new point, with all values set to zero.
+     * @return Index of the point.
+     */
+    int allocatePoint();
+    /**
+     * Releases a point, which may then be reused by allocatePoint.
+     * @param point Index of the point.
+     */
+    void releasePoint(int point);
+
+    /// Returns committed value of given point.
+    double giveCommitted(int point, int value) const
+    {
+        return * giveValue(giveFlags(point) & 1, point, value);
+    }
+    /// Returns temporary value of given point.
+    double giveTemp(int point, int value) const
+    {
+        unsigned char flags = giveFlags(point);
+        return * giveValue( ( flags & 2 ) ? 1 - ( flags & 1 ) : ( flags & 1 ), point, value );
+    }
+    /// Sets the committed value of given point.
+    void setCommitted(int point, int value, double v);
+    /// Sets the temporary value of given point.
+    void setTemp(int point, int value, double v)
+    {
+        if ( !( giveFlags(point) & 2 ) ) {
+            this->validateTemp(point);
+        }
+        * giveValue(1 - ( giveFlags(point) & 1 ), point, value) = v;
+    }
+
+    /// Initializes temporary state of given point according to committed one.
+    void initTemp(int point) { giveFlags(point) &= 1; }
+    /// Makes the temporary state of given point the committed one.
+    void commit(int point)
+    {
+        unsigned char &flags = giveFlags(point);
+        if ( flags & 2 ) {
+            flags = 1 - ( flags & 1 );
+        }
+    }
+};
+
+
+/**
+ * View of the values of one point in MaterialStateStorage.
+ * Statuses using the storage keep a view, in which value indices correspond to their history variables.
+ */
+class OOFEM_EXPORT MaterialStateView
+{
+protected:
+    /// Storage, shared with the material, so that it outlives the view when the material is deleted first.
+    std :: shared_ptr< MaterialStateStorage >storage;
+    int point;
+
+public:
+    MaterialStateView() : storage(), point(0) { }
+    MaterialStateView(const MaterialStateView &) = delete;
+    MaterialStateView &operator = ( const MaterialStateView & ) = delete;
+    /// Releases the point of the receiver.
+    ~MaterialStateView() { this->detach(); }
+
+    /// Returns true if view is attached to a storage.
+    bool isAttached() const { return storage != NULL; }
+    /// Releases the point of the receiver and detaches it from the storage.
+    void detach()
+    {
+        if ( storage ) {
+            storage->releasePoint(point);
+            storage.reset();
+        }
+    }
+    /// Releases the point of the receiver and attaches it to a new point in given storage.
+    void attach(std :: shared_ptr< MaterialStateStorage >s)
+    {
+        this->detach();
+        point = s->allocatePoint();
+        storage = std :: move(s);
+    }
+
+    double giveCommitted(int value) const { return storage->giveCommitted(point, value); }
+    double giveTemp(int value) const { return storage->giveTemp(point, value); }
+    void setCommitted(int value, double v) { storage->setCommitted(point, value, v); }
+    void setTemp(int value, double v) { storage->setTemp(point, value, v); }
+    void initTemp() { storage->initTemp(point); }
+    void commit() { storage->commit(point); }
+};
+} // end namespace oofem
+#endif // materialstatestorage_h
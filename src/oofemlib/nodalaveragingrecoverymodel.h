@@ -69,7 +69,14 @@ public:
     /// Destructor.
     ~NodalAveragingRecoveryModel();
 
-    int recoverValues(Set elementSet, InternalStateType type, TimeStep *tStep);
+    int recoverValues(Set &elementSet, InternalStateType type, TimeStep *tStep);
+    /**
+     * Recovers all requested types in a single pass over the elements of the region.
+     * With OpenMP, each thread sums the nodal values of its elements separately and the sums are
+     * added in thread order afterwards.
+     * In parallel (distributed) runs the types are recovered one after another.
+     */
+    int recoverValues(Set &elementSet, const IntArray &types, TimeStep *tStep);
 
     virtual const char *giveClassName() const { return "NodalAveragingRecoveryModel"; }
 
@@ -79,6 +79,18 @@ protected:
     StateCounterType stateCounter;
     Domain *domain;
 
+    /**
+     * Map of nodal values of several internal state types recovered at once.
+     * The type and node number are the dictionary keys.
+     */
+    std :: map< InternalStateType, std :: map< int, FloatArray > >multiValList;
+    /// Element set over which the values in multiValList were last requested.
+    Set *multiValSet;
+    /// Elements of the region over which the values in multiValList are recovered.
+    IntArray multiValElements;
+    /// Time stamp of values in multiValList.
+    StateCounterType multiValStateCounter;
+
 #ifdef __PARALLEL_MODE
     /// Common Communicator buffer.
     CommunicatorBuff *commBuff;
@@ -101,7 +113,25 @@ public:
      * @param type Determines the type of internal variable to be recovered.
      * @param tStep Time step.
      */
-    virtual int recoverValues(Set elementSet, InternalStateType type, TimeStep *tStep) = 0;
+    virtual int recoverValues(Set &elementSet, InternalStateType type, TimeStep *tStep) = 0;
+    /**
+     * Recovers the nodal values of several internal state types.
+     * The recovered values are kept for the current solution state and can be requested by
+     * giveNodalVector(ptr, node, type). This allows to export all variables
+     * after a single recovery. Types already recovered on a region with the same elements
+     * in the same solution state are not recovered again, also when requested through a different set,
+     * so that several export modules sharing the receiver recover each type once.
+     * The default implementation recovers the types one after another.
+     * @param elementSet Element set defining the region.
+     * @param types Types of internal variables to be recovered.
+     * @param tStep Time step.
+     */
+    virtual int recoverValues(Set &elementSet, const IntArray &types, TimeStep *tStep);
+    /**
+     * Checks if values of given type have already been recovered on given element set
+     * for the current solution state by recoverValues(elementSet, types, tStep).
+     */
+    bool hasRecoveredValues(Set &elementSet, InternalStateType type, TimeStep *tStep) const;
     /**
      * Clears the receiver's nodal table.
      * @return nonzero if o.k.
@@ -114,6 +144,15 @@ public:
      * @return Nonzero if values are defined, zero otherwise.
      */
     int giveNodalVector(const FloatArray * &ptr, int node);
+    /**
+     * Returns vector of recovered values of given type for given node.
+     * Values recovered for several types at once are searched first.
+     * @param ptr Pointer to recovered values at node, NULL if not present.
+     * @param node Node number.
+     * @param type Type of recovered variable.
+     * @return Nonzero if values are defined, zero otherwise.
+     */
+    int giveNodalVector(const FloatArray * &ptr, int node, InternalStateType type);
     /**
      * Returns the region record size. Available after recovery.
      * @param reg Virtual region id.
@@ -134,6 +173,12 @@ protected:
      * @returns Nonzero if ok, zero if region has to be skipped.
      */
     int initRegionNodeNumbering(IntArray &regionNodalNumbers, int &regionDofMans, Set &region);
+    /**
+     * Checks if the values in multiValList are recovered on the elements of given set in the current solution state.
+     */
+    bool isMultiValCurrent(Set &elementSet, TimeStep *tStep) const;
+    /// Marks the values in multiValList as recovered on given set in the current solution state.
+    void setMultiValState(Set &elementSet, TimeStep *tStep);
 
     /**
      * Update the nodal table according to recovered solution for given region.
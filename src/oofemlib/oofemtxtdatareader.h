@@ -61,6 +61,11 @@ protected:
 public:
     /// Constructor.
     OOFEMTXTDataReader(std :: string inputfilename);
+    /**
+     * Copy constructor. Copies the parsed records of given reader, which makes it possible to
+     * instantiate the same problem several times without reading the input file again.
+     * The copy starts reading from the first record.
+     */
     OOFEMTXTDataReader(const OOFEMTXTDataReader & x);
     virtual ~OOFEMTXTDataReader();
 
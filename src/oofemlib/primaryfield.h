@@ -80,6 +80,24 @@ public:
      */
     virtual int EIPrimaryFieldI_evaluateFieldVectorAt(FloatArray &answer, PrimaryField &pf,
                                                       const FloatArray &coords, IntArray &dofId, ValueModeType mode, TimeStep *tStep) = 0;
+    /**
+     * Evaluates the value of field at given point of interest, whose local coordinates in receiver are already known
+     * (typically from cached point location). The default implementation ignores the local coordinates and
+     * evaluates the field at global coordinates.
+     * @param answer Field evaluated at coordinate.
+     * @param pf Field to use for evaluation.
+     * @param coords Global coordinate.
+     * @param lcoords Local coordinate of the point in receiver.
+     * @param dofId IDs of DOFs to evaluate.
+     * @param mode Mode of field.
+     * @param tStep Time step to evaluate at.
+     * @return Zero if ok, nonzero when error encountered.
+     */
+    virtual int EIPrimaryFieldI_evaluateFieldVectorAtLocal(FloatArray &answer, PrimaryField &pf, const FloatArray &coords,
+                                                           const FloatArray &lcoords, IntArray &dofId, ValueModeType mode, TimeStep *tStep)
+    {
+        return this->EIPrimaryFieldI_evaluateFieldVectorAt(answer, pf, coords, dofId, mode, tStep);
+    }
     //@}
 };
 
@@ -41,8 +41,12 @@
 #include "error.h"
 #include "set.h"
 
+#include "floatarray.h"
+
 #include <set>
 #include <list>
+#include <map>
+#include <array>
 
 namespace oofem {
 class Domain;
@@ -113,6 +117,26 @@ protected:
     /// Link to domain object
     Domain *domain;
 
+    /// Record of point location, element number and local coordinates of the point in it.
+    struct PointLocation {
+        int element;
+        int nlcoords;
+        std :: array< double, 3 >lcoords;
+    };
+    typedef std :: map< std :: array< double, 3 >, PointLocation >PointLocationMap;
+    /**
+     * Cache of located points, keyed by global coordinates of the point (padded by zeros).
+     * The cache is kept in two generations. When the recent one is full, it replaces the old one,
+     * so that only points not used since the previous rotation are dropped. Hits in the old
+     * generation are moved back to the recent one.
+     */
+    PointLocationMap pointLocationCache, oldPointLocationCache;
+    /// Maximal number of points in one generation of the cache.
+    enum { PointLocationCacheSize = 250000 };
+
+    /// Inserts point location into the cache, rotating the generations if necessary. Not thread safe.
+    PointLocation &cachePointLocation(const std :: array< double, 3 > &key, const PointLocation &loc);
+
 public:
     /// Typedefs to introduce the container type for element numbers, returned by some services.
     typedef std :: set< int > elementContainerType;
@@ -141,6 +165,18 @@ public:
      * @return The element belonging to associated domain, containing given point, NULL otherwise.
      */
     virtual Element *giveElementContainingPoint(const FloatArray &coords, const Set &eset) = 0;
+    /**
+     * Returns the element containing given point together with the local coordinates of the point.
+     * The result is cached, so that fields evaluated repeatedly at the same points (typically at integration
+     * points of another problem in staggered analysis) avoid the search and the inverse mapping.
+     * The cache is invalidated when the receiver is reinitialized by init(true), and by the domain when the elements or nodes change.
+     * @param[out] lcoords Local coordinates of the point in the element found.
+     * @param coords Global problem coordinates of point of interest.
+     * @return The element containing given point, NULL if there is none or if the mapping to its local coordinates fails.
+     */
+    Element *giveElementContainingPointCached(FloatArray &lcoords, const FloatArray &coords);
+    /// Clears the cache of located points.
+    void clearPointLocationCache();
     /**
      * Returns the element closest to a given point.
      * @param[out] lcoords Local coordinates in element found.
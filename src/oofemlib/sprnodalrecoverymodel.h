@@ -80,7 +80,7 @@ public:
     /// Destructor.
     virtual ~SPRNodalRecoveryModel();
 
-    virtual int recoverValues(Set elementSet, InternalStateType type, TimeStep *tStep);
+    virtual int recoverValues(Set &elementSet, InternalStateType type, TimeStep *tStep);
 
     virtual const char *giveClassName() const { return "SPRNodalRecoveryModel"; }
 
@@ -95,7 +95,12 @@ private:
     void initRegionMap(IntArray &regionMap, IntArray &regionTypes, InternalStateType type);
 
     void determinePatchAssemblyPoints(IntArray &pap, SPRPatchType regType, Set &elemset);
-    void initPatch(IntArray &patchElems, IntArray &dofManToDetermine, IntArray &pap, int papNumber, Set &elementList);
+    /**
+     * Determines the elements of the patch assembled around given assembly point and
+     * the dofManagers whose values will be determined from it.
+     * @param papInv Inverted array of patch assembly points (nonzero for dofManagers that are assembly points).
+     */
+    void initPatch(IntArray &patchElems, IntArray &dofManToDetermine, const IntArray &papInv, int papNumber, Set &elementList);
     void computePatch(FloatMatrix &a, IntArray &patchElems, int &regionValSize,
                       SPRPatchType regType, InternalStateType type, TimeStep *tStep);
     void determineValuesFromPatch(FloatArray &dofManValues, IntArray &dofManCount,
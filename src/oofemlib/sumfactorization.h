@@ -0,0 +1,159 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef sumfactorization_h
+#define sumfactorization_h
+
+#include "oofemcfg.h"
+#include "floatarray.h"
+#include "floatmatrix.h"
+#include "intarray.h"
+
+#include <vector>
+
+namespace oofem {
+class IntegrationRule;
+
+/**
+ * Interface of interpolations whose shape functions are tensor products of one-dimensional functions,
+ * @f$ N_i(\xi, \eta, \zeta) = n_a(\xi) n_b(\eta) n_c(\zeta) @f$.
+ * The same one-dimensional functions are used in all directions.
+ */
+class OOFEM_EXPORT FEITensorProduct
+{
+public:
+    virtual ~FEITensorProduct() { }
+
+    /// Returns the number of one-dimensional functions in each direction.
+    virtual int giveNumberOf1dFunctions() const = 0;
+    /**
+     * Evaluates the one-dimensional functions and their derivatives.
+     * @param N Values of the functions.
+     * @param dN Derivatives of the functions.
+     * @param xi Natural coordinate.
+     */
+    virtual void eval1dFunctions(FloatArray &N, FloatArray &dN, double xi) const = 0;
+    /**
+     * Gives the tensor position of each node, i.e. the 0-based index @f$ a + n b + n^2 c @f$
+     * of the one-dimensional functions which form the shape function of the node.
+     * @param answer Tensor position, one entry per node.
+     */
+    virtual void giveTensorProductNodeOrdering(IntArray &answer) const = 0;
+};
+
+
+/**
+ * Sum factorization kernel for tensor product interpolations integrated with tensor product Gauss rules.
+ * Interpolated values, reference gradients and the integration of fluxes against shape function gradients
+ * are evaluated as a sequence of one-dimensional contractions, one direction at a time.
+ * For @f$ p+1 @f$ functions and @f$ q @f$ points per direction this costs @f$ O(d (p+1) q^d) @f$ operations
+ * instead of @f$ O((p+1)^d q^d) @f$ for the evaluation through full shape function tables.
+ *
+ * Nodal vectors are ordered by nodes (all components of the first node first), as element vectors are.
+ * Point quantities are stored column-wise, one column per integration point in the order of the integration rule.
+ */
+class OOFEM_EXPORT SumFactorizationKernel
+{
+protected:
+    /// Number of spatial dimensions.
+    int nsd;
+    /// Number of one-dimensional functions in each direction.
+    int nf;
+    /// Number of one-dimensional integration points in each direction.
+    int nq;
+    /// Values and derivatives of the one-dimensional functions at the one-dimensional points (nq x nf).
+    FloatMatrix N1, dN1;
+    /// Tensor position of each node.
+    IntArray nodeOrdering;
+    /// Tensor position of each integration point.
+    IntArray pointOrdering;
+
+public:
+    SumFactorizationKernel() : nsd(0), nf(0), nq(0) { }
+
+    /**
+     * Tabulates the one-dimensional functions at the points of the given rule.
+     * @param interp Tensor product interpolation.
+     * @param nsd Number of spatial dimensions (2 or 3).
+     * @param iRule Integration rule.
+     * @return False if the rule is not a tensor product Gauss rule, in which case the kernel can not be used.
+     */
+    bool initialize(const FEITensorProduct &interp, int nsd, IntegrationRule &iRule);
+    /// Returns true if the kernel has been successfully initialized.
+    bool isInitialized() const { return nf > 0; }
+    /// Returns the number of spatial dimensions.
+    int giveNumberOfSpatialDimensions() const { return nsd; }
+    /// Returns the number of nodes.
+    int giveNumberOfNodes() const { return nodeOrdering.giveSize(); }
+    /// Returns the number of integration points.
+    int giveNumberOfPoints() const { return pointOrdering.giveSize(); }
+
+    /**
+     * Interpolates nodal values to the integration points.
+     * @param answer Interpolated values (ncomp x npoints).
+     * @param u Nodal values.
+     * @param ncomp Number of components per node.
+     */
+    void evalValues(FloatMatrix &answer, const FloatArray &u, int ncomp) const;
+    /**
+     * Evaluates the gradients of the interpolated field with respect to the natural coordinates.
+     * @param answer Gradients (ncomp*nsd x npoints), the derivative of component c with respect to direction d being in row c*nsd + d (0-based).
+     * @param u Nodal values.
+     * @param ncomp Number of components per node.
+     */
+    void evalReferenceGradients(FloatMatrix &answer, const FloatArray &u, int ncomp) const;
+    /**
+     * Transpose of evalReferenceGradients; sums the fluxes times the natural derivatives of the shape functions over the points.
+     * Integration weights have to be included in the fluxes.
+     * @param answer Nodal vector.
+     * @param flux Fluxes, in the layout of evalReferenceGradients.
+     * @param ncomp Number of components per node.
+     */
+    void integrateReferenceGradients(FloatArray &answer, const FloatMatrix &flux, int ncomp) const;
+
+protected:
+    /**
+     * Applies a one-dimensional operator along a single direction of a tensor.
+     * @param y Output tensor.
+     * @param A Operator (nq x nf).
+     * @param transpose If true the transpose of A is applied, mapping points to functions.
+     * @param x Input tensor.
+     * @param dims Extents of the input tensor, updated to the extents of the output.
+     * @param dir Direction along which A is applied.
+     */
+    static void contract(std :: vector< double > &y, const FloatMatrix &A, bool transpose,
+                         const std :: vector< double > &x, int dims[3], int dir);
+};
+} // end namespace oofem
+#endif // sumfactorization_h
@@ -51,6 +51,9 @@
 #include "pfem/octreelocalizert.h"
 #include "error.h"
 
+#include <map>
+#include <vector>
+
 namespace oofem {
 
 /**
@@ -216,6 +219,23 @@ protected:
     int getVertexNum (int i) {
       return this->vertices(i);
     }
+    /// Evaluates interpolation functions at given point, returns zero if the point could not be mapped into the cell.
+    int evalN (FloatArray& N, const FloatArray& pos) {
+      FloatArray lcoords;
+      FEInterpolation* it = this->getInterpolation();
+      FEICellGeometryWrapper cw (this);
+      if (!it->global2local(lcoords, pos, cw)) {
+        return 0;
+      }
+      it->evalN (N, lcoords, cw);
+      return 1;
+    }
+  };
+
+  /* Located point: vertices of the cell containing the point and values of cell interpolation functions at the point */
+  struct PointInterpolation {
+    IntArray vertices;
+    FloatArray N;
   };
 
 
@@ -304,12 +324,22 @@ protected:
   long int timeStamp;
   /// octree origin shift
   double octreeOriginShift;
+  typedef std::map<std::vector<double>, PointInterpolation> PointInterpolationMap;
+  /**
+   * Cache of located points, keyed by point coordinates. Kept in two generations,
+   * when the recent one is full, it replaces the old one (see SpatialLocalizer).
+   */
+  PointInterpolationMap pointCache, oldPointCache;
+  /// Maximal number of points in one generation of the cache.
+  enum { PointCacheSize = 250000 };
+  /// point cache time stamp
+  long int pointCacheTimeStamp;
  public:
   /**
    * Constructor. Creates a field, with unspecified field values.
    */
  UnstructuredGridField(int nvert, int ncells, double octreeOriginShift=0.0 ) : Field(FieldType::FT_Unknown), spatialLocalizer()
-    { this->timeStamp = this->octreeTimeStamp = 0;
+    { this->timeStamp = this->octreeTimeStamp = this->pointCacheTimeStamp = 0;
       this->vertexList.resize(nvert);
       this->cellList.resize(ncells);
       this->valueList.resize(nvert);
@@ -335,23 +365,17 @@ protected:
 
   int evaluateAt(FloatArray &answer, const FloatArray &coords,
 		 ValueModeType mode, TimeStep *tStep) override {
-    std::list<Cell> elist;
     if ((mode == VM_Total) || (mode == VM_TotalIntrinsic)) {
-      this->initOctree();
-      CellContainingPointFunctor f(coords);
-      this->spatialLocalizer.giveDataOnFilter(elist, f);
-      if (elist.size()) {
-	Cell &c = elist.front(); // take first
-	// colect vertex values
-	int size = c.giveNumberOfVertices();
-	FloatArray** vertexValues = new FloatArray*[size]; 
-	for (int i=0; i<size; i++) {
-	  vertexValues[i]=&(this->valueList[c.getVertexNum(i)]);
-	}
-	c.interpolate (answer, coords, vertexValues);
-	return 0;
+      PointInterpolation pi;
+      if (this->givePointInterpolation(pi, coords)) {
+        // interpolate vertex values using cached interpolation functions
+        answer.clear();
+        for (int i=0; i<pi.vertices.giveSize(); i++) {
+          answer.add(pi.N(i), this->valueList[pi.vertices(i)]);
+        }
+        return 0;
       } else {
-	return 1;
+        return 1;
       }
     } else {
       OOFEM_ERROR("Unsupported ValueModeType");
@@ -390,6 +414,66 @@ protected:
   const char *giveClassName() const override { return "UnstructuredGridField"; }
   
  protected:
+  /**
+   * Locates the cell containing given point and evaluates its interpolation functions at the point.
+   * The result is cached, as the field is typically evaluated repeatedly at the same points
+   * (only vertex values change). The cache is invalidated when the grid changes.
+   * The field may be evaluated from parallel element loops, the cache (and the octree built on demand)
+   * is therefore accessed in a critical section and the result is returned by value.
+   * @param[out] answer Interpolation of the point.
+   * @return Nonzero if the point is within grid, zero otherwise.
+   */
+  int givePointInterpolation(PointInterpolation &answer, const FloatArray &coords) {
+    int result = 0;
+#ifdef _OPENMP
+ #pragma omp critical (UnstructuredGridField_pointCache)
+#endif
+    {
+      if (this->pointCacheTimeStamp != this->timeStamp) {
+        this->pointCache.clear();
+        this->oldPointCache.clear();
+        this->pointCacheTimeStamp = this->timeStamp;
+      }
+
+      std::vector<double> key(coords.begin(), coords.end());
+      auto it = this->pointCache.find(key);
+      if (it != this->pointCache.end()) {
+        answer = it->second;
+        result = 1;
+      } else {
+        auto oldIt = this->oldPointCache.find(key);
+        if (oldIt != this->oldPointCache.end()) {
+          answer = oldIt->second;
+          this->oldPointCache.erase(oldIt);
+          result = 1;
+        } else {
+          std::list<Cell> elist;
+          this->initOctree();
+          CellContainingPointFunctor f(coords);
+          this->spatialLocalizer.giveDataOnFilter(elist, f);
+          if (elist.size()) {
+            Cell &c = elist.front(); // take first
+            answer.vertices.resize(c.giveNumberOfVertices());
+            for (int i=0; i<c.giveNumberOfVertices(); i++) {
+              answer.vertices(i) = c.getVertexNum(i);
+            }
+            result = c.evalN(answer.N, coords);
+          }
+        }
+
+        if (result) {
+          if (this->pointCache.size() >= PointCacheSize) {
+            // drop the points not used since the last rotation
+            this->oldPointCache.swap(this->pointCache);
+            this->pointCache.clear();
+          }
+          this->pointCache[key] = answer;
+        }
+      }
+    }
+    return result;
+  }
+
   void initOctree() {
     if (this->timeStamp != this->octreeTimeStamp) {
       // rebuild octree
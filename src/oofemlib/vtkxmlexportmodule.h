@@ -160,8 +160,6 @@ protected:
 
     /// Smoother type.
     NodalRecoveryModel :: NodalRecoveryModelType stype;
-    /// Smoother.
-    NodalRecoveryModel *smoother;
     /// Smoother for primary variables.
     NodalRecoveryModel *primVarSmoother;
 
@@ -182,7 +180,6 @@ public:
 
     virtual IRResultType initializeFrom(InputRecord *ir);
     virtual void doOutput(TimeStep *tStep, bool forcedOutput = false);
-    virtual void initialize();
     virtual void reInitialize();	
     virtual void terminate();
     virtual const char *giveClassName() const { return "VTKXMLExportModule"; }
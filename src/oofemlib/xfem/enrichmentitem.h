@@ -149,6 +149,15 @@ public:
 
     virtual bool hasPropagatingFronts() const;
 
+    /**
+     * Revision number of the geometry of the receiver. It is increased
+     * every time the geometry changes (e.g. when a front propagates), and is used
+     * to validate cached data derived from the geometry, such as the subdivision of cut elements.
+     */
+    int giveGeometryRevision() const { return mGeometryRevision; }
+    void setGeometryRevision(int iRevision) { mGeometryRevision = iRevision; }
+    void increaseGeometryRevision() { mGeometryRevision++; }
+
 
     int giveStartOfDofIdPool() const { return this->startOfDofIdPool; }
     int giveEndOfDofIdPool() const { return this->endOfDofIdPool; }
@@ -275,6 +284,9 @@ protected:
 
     bool mLevelSetsNeedUpdate;
 
+    /// Revision number of the geometry.
+    int mGeometryRevision;
+
     static const double mLevelSetTol;
     static const double mLevelSetRelTol;
     const double mLevelSetTol2;
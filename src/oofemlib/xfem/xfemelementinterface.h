@@ -124,6 +124,14 @@ public:
     virtual void XfemElementInterface_prepareNodesForDelaunay(std :: vector< std :: vector< FloatArray > > &oPointPartitions, double &oCrackStartXi, double &oCrackEndXi, int iEnrItemIndex, bool &oIntersection);
     virtual void XfemElementInterface_prepareNodesForDelaunay(std :: vector< std :: vector< FloatArray > > &oPointPartitions, double &oCrackStartXi, double &oCrackEndXi, const Triangle &iTri, int iEnrItemIndex, bool &oIntersection);
 
+    /**
+     * Gives the triangulation of the element cut by the enrichment item iEnrItemIndex.
+     * The triangulation is reused from the XfemManager cache if the geometry of the
+     * enrichment item has not changed, otherwise it is computed and stored in the cache.
+     * The triangles are appended to oTriangles.
+     */
+    void XfemElementInterface_giveCutElementPartition(std :: vector< Triangle > &oTriangles, double &oCrackStartXi, double &oCrackEndXi, int iEnrItemIndex, bool &oIntersection);
+
     // Help functions for partitioning
     void putPointsInCorrectPartition(std :: vector< std :: vector< FloatArray > > &oPointPartitions, const std :: vector< FloatArray > &iIntersecPoints, const std :: vector< const FloatArray * > &iNodeCoord) const;
 
@@ -43,8 +43,10 @@
 #include "enrichmentitem.h"
 #include "enumitem.h"
 #include "internalstatevaluetype.h"
+#include "geometry.h"
 
 #include <unordered_map>
+#include <map>
 #include <list>
 #include <vector>
 #include <memory>
@@ -97,6 +99,23 @@ enum XFEMStateType {
 
 const char *__XFEMStateTypeToString(XFEMStateType _value);
 
+/**
+ * Subdivision of an element cut by a single enrichment item.
+ * The partition only depends on the element nodes and the geometry of the
+ * enrichment item, and is therefore valid as long as the geometry revision
+ * of the enrichment item is unchanged.
+ */
+struct XfemCutElementPartition {
+    /// Geometry revision of the enrichment item when the partition was computed.
+    int mGeometryRevision;
+    /// If the enrichment item intersects the element.
+    bool mIntersection;
+    /// Arc length positions (normalized by the length of the enrichment item) where the enrichment item enters and leaves the element.
+    double mStartXi, mEndXi;
+    /// Triangulation of the element.
+    std :: vector< Triangle >mTriangles;
+};
+
 /**
  * This class manages the xfem part
  *
@@ -147,6 +166,13 @@ protected:
      */
     std :: vector< int >mMaterialModifyingEnrItemIndices;
 
+    /**
+     * Cache of cut element partitions, keyed on element global number and
+     * enrichment item index. Allows elements to reuse their subdivision
+     * when integration rules are recreated and the enrichment item has not moved.
+     */
+    std :: map< std :: pair< int, int >, XfemCutElementPartition >mCutElementPartitions;
+
 public:
 
     /**
@@ -216,12 +242,55 @@ public:
     bool giveVtkDebug() const { return mDebugVTK; }
     void setVtkDebug(bool iDebug) { mDebugVTK = iDebug; }
 
+    /// Rebuilds the node and element enrichment item maps from scratch.
     void updateNodeEnrichmentItemMap();
+    /**
+     * Incrementally updates the node and element enrichment item maps after
+     * enrichment item iEIIndex has changed. Only nodes that have been added to or
+     * removed from the enrichment item compared to iOldEnrNodeMap, and the elements
+     * connected to them, are visited.
+     * @param iEIIndex Index of the modified enrichment item.
+     * @param iOldEnrNodeMap Node enrichment markers of the item before the modification.
+     */
+    void updateNodeEnrichmentItemMap(int iEIIndex, const std :: unordered_map< int, NodeEnrichmentType > &iOldEnrNodeMap);
+    /**
+     * Checks the node and element enrichment item maps against a complete rebuild.
+     * Called after every incremental update in debug builds, an error is raised on mismatch.
+     */
+    void checkNodeEnrichmentItemMap();
+    /// Collects the enrichment items that can modify the material (e.g. cohesive zones).
+    void updateMaterialModifyingEnrItemIndices();
 
     const std :: vector< int > &giveNodeEnrichmentItemIndices(int iNodeIndex) const { return mNodeEnrichmentItemIndices [ iNodeIndex - 1 ]; }
     void giveElementEnrichmentItemIndices(std :: vector< int > &oElemEnrInd, int iElementIndex) const;
 
     const std :: vector< int > &giveMaterialModifyingEnrItemIndices() const { return mMaterialModifyingEnrItemIndices; }
+
+    /**
+     * Returns the cached partition of an element cut by an enrichment item,
+     * or NULL if no partition is stored for the current geometry of the enrichment item.
+     * @param iElGlobalNum Global number of the element.
+     * @param iEIIndex Index of the enrichment item.
+     */
+    const XfemCutElementPartition *giveCutElementPartition(int iElGlobalNum, int iEIIndex) const;
+    /**
+     * Stores the partition of an element cut by an enrichment item.
+     * The partition is stamped with the current geometry revision of the enrichment item.
+     * @return Reference to the stored partition.
+     */
+    const XfemCutElementPartition &setCutElementPartition(int iElGlobalNum, int iEIIndex, XfemCutElementPartition iPartition);
+    /**
+     * Removes cached partitions that are outdated by a change of enrichment item geometry.
+     * All partitions of a propagated enrichment item are removed, also for elements away from the tips,
+     * since the stored arc length positions are normalized by the total length of the item.
+     */
+    void purgeCutElementPartitions();
+    /**
+     * Takes over the cached partitions and enrichment item geometry revisions from another manager.
+     * Used when the domain is cloned, so that elements cut only by enrichment items that have
+     * not propagated need not be subdivided again.
+     */
+    void copyCutElementPartitions(const XfemManager &iSrc);
 };
 } // end namespace oofem
 #endif // xfemmanager_h
@@ -70,7 +70,7 @@ public:
     /// Destructor.
     virtual ~ZZNodalRecoveryModel();
 
-    virtual int recoverValues(Set elementSet, InternalStateType type, TimeStep *tStep);
+    virtual int recoverValues(Set &elementSet, InternalStateType type, TimeStep *tStep);
 
     virtual const char *giveClassName() const { return "ZZNodalRecoveryModel"; }
 
@@ -128,11 +128,14 @@ public:
     virtual void giveRealStress_AxisymMembrane1d(FloatArray &answer, GaussPoint *gp, const FloatArray &strain, TimeStep *tStep);
     
 
+    virtual void giveRealStressesBatch(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps, const FloatMatrix &reducedStrains, TimeStep *tStep);
+
     virtual void giveStiffnessMatrix_3d(FloatMatrix &answer, MatResponseMode mode, GaussPoint *gp, TimeStep *tStep);
     virtual void giveStiffnessMatrix_PlaneStress(FloatMatrix &answer, MatResponseMode mode, GaussPoint *gp, TimeStep *tStep);
     virtual void giveStiffnessMatrix_PlaneStrain(FloatMatrix &answer, MatResponseMode mode, GaussPoint *gp, TimeStep *tStep);
     virtual void giveStiffnessMatrix_1d(FloatMatrix &answer, MatResponseMode mode, GaussPoint *gp, TimeStep *tStep);
      virtual void giveStiffnessMatrix_AxisymMembrane1d(FloatMatrix &answer, MatResponseMode mode, GaussPoint *gp, TimeStep *tStep);
+    virtual void giveStiffnessMatrixBatch(std :: vector< FloatMatrix > &answer, MatResponseMode mode, const std :: vector< GaussPoint * > &gps, TimeStep *tStep);
 
 
     virtual void giveGeneralizedStress_Beam2d(FloatArray &answer, GaussPoint *gp, const FloatArray &generalizedStrain, TimeStep *tStep);
@@ -255,6 +258,57 @@ virtual void giveInitialStiffnessMatrix_Cauchy(FloatMatrix &answer, MatResponseM
 
 protected:
     double giveArea();
+
+    /**
+     * Gives the layer of each point of a batch of 3d points of layered cube or wedge rules.
+     * @return False if some point is not such a point.
+     */
+    bool giveLayersOf3dPoints(IntArray &answer, const std :: vector< GaussPoint * > &gps);
+    /**
+     * Gives the transformation of strains from the element axes to the material axes of a rotated layer,
+     * layer stresses are transformed back by its transpose.
+     * @param answer Transformation matrix.
+     * @param mode Material mode of the layer points (_3dMat or _PlateLayer).
+     * @param layer Layer number.
+     */
+    void giveLayerRotationMatrix(FloatMatrix &answer, MaterialMode mode, int layer);
+    /**
+     * Evaluates the stresses of a batch of layer points.
+     * Points of layers sharing a material are passed to the material as one batch.
+     * @param answer Stresses in the element axes, one column per point.
+     * @param gps Layer points.
+     * @param layers Layer of each point.
+     * @param strains Strains in the element axes, one column per point.
+     * @param tStep Time step.
+     */
+    void giveLayerStressesBatch(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps, const IntArray &layers,
+                                const FloatMatrix &strains, TimeStep *tStep);
+    /// Evaluates the stiffness matrices of a batch of layer points in the element axes, see giveLayerStressesBatch.
+    void giveLayerStiffnessBatch(std :: vector< FloatMatrix > &answer, MatResponseMode rMode, const std :: vector< GaussPoint * > &gps,
+                                 const IntArray &layers, TimeStep *tStep);
+    /**
+     * Gives the slave points of all layers of a master point with their integration weights (width times thickness)
+     * and z-coordinates.
+     */
+    void giveLayerPoints(std :: vector< GaussPoint * > &answer, IntArray &layers, FloatArray &weights, FloatArray &zCoords, GaussPoint *gp);
+    /**
+     * Evaluates the stresses in all layers of a master point.
+     * @param answer Layer stresses, one column per layer.
+     * @param weights Integration weights of the layers.
+     * @param zCoords z-coordinates of the layers.
+     * @param gp Master point.
+     * @param strain Generalized strain of the master point.
+     * @param tStep Time step.
+     */
+    void giveLayerStresses(FloatMatrix &answer, FloatArray &weights, FloatArray &zCoords,
+                           GaussPoint *gp, const FloatArray &strain, TimeStep *tStep);
+    /**
+     * Integrates the layer stiffness matrices over the thickness of a master point.
+     * @param a Integral of the layer stiffness.
+     * @param b First moment of the layer stiffness (membrane-bending coupling).
+     * @param d Second moment of the layer stiffness.
+     */
+    void giveLayerStiffnessResultants(FloatMatrix &a, FloatMatrix &b, FloatMatrix &d, MatResponseMode rMode, GaussPoint *gp, TimeStep *tStep);
 };
 
 /**
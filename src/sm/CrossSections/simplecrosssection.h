@@ -107,7 +107,10 @@ public:
     virtual void giveStiffnessMatrix_PlaneStrain(FloatMatrix &answer, MatResponseMode mode, GaussPoint *gp, TimeStep *tStep);
     virtual void giveStiffnessMatrix_1d(FloatMatrix &answer, MatResponseMode mode, GaussPoint *gp, TimeStep *tStep);
     virtual void giveStiffnessMatrix_AxisymMembrane1d(FloatMatrix &answer, MatResponseMode mode, GaussPoint *gp, TimeStep *tStep);
-    
+
+    /// Passes the whole batch to the material, if all points share the material and a supported material mode.
+    virtual void giveRealStressesBatch(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps, const FloatMatrix &reducedStrains, TimeStep *tStep);
+    virtual void giveStiffnessMatrixBatch(std :: vector< FloatMatrix > &answer, MatResponseMode mode, const std :: vector< GaussPoint * > &gps, TimeStep *tStep);
 
 
     virtual void giveGeneralizedStress_Beam2d(FloatArray &answer, GaussPoint *gp, const FloatArray &generalizedStrain, TimeStep *tStep);
@@ -180,6 +183,9 @@ public:
 protected:
     int materialNumber;   // material number
     int czMaterialNumber; // cohesive zone material number
+
+    /// Returns the material common to all given points, if the batch can be passed to it, NULL otherwise.
+    StructuralMaterial *giveBatchMaterial(const std :: vector< GaussPoint * > &gps);
 };
 } // end namespace oofem
 #endif // simplecrosssection_h
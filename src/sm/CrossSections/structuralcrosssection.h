@@ -109,6 +109,17 @@ public:
      virtual void giveRealStress_AxisymMembrane1d(FloatArray &answer, GaussPoint *gp, const FloatArray &strain, TimeStep *tStep) = 0;
     //@}
 
+    /**
+     * Computes the real stresses for a batch of integration points sharing the material mode
+     * (_3dMat, _PlaneStrain, _PlaneStress or _1dMat). The strains and stresses are stored column-wise,
+     * one column per integration point. The default implementation evaluates the points one by one.
+     * @param answer Stresses, one column per integration point.
+     * @param gps Integration points.
+     * @param reducedStrains Strains in reduced form, one column per integration point.
+     * @param tStep Current time step.
+     */
+    virtual void giveRealStressesBatch(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps, const FloatMatrix &reducedStrains, TimeStep *tStep);
+
     /**
      * Method for computing the stiffness matrix.
      * @param answer Stiffness matrix.
@@ -124,6 +135,16 @@ public:
     virtual void giveStiffnessMatrix_AxisymMembrane1d(FloatMatrix &answer, MatResponseMode mode, GaussPoint *gp, TimeStep *tStep) = 0;
     //@}
 
+    /**
+     * Computes the stiffness matrices for a batch of integration points sharing the material mode
+     * (_3dMat, _PlaneStrain, _PlaneStress or _1dMat). The default implementation evaluates the points one by one.
+     * @param answer Stiffness matrices, one for each integration point.
+     * @param mode Material response mode.
+     * @param gps Integration points.
+     * @param tStep Current time step.
+     */
+    virtual void giveStiffnessMatrixBatch(std :: vector< FloatMatrix > &answer, MatResponseMode mode, const std :: vector< GaussPoint * > &gps, TimeStep *tStep);
+
     /**
      * Computes the generalized stress vector for given strain and integration point.
      * @param answer Contains result.
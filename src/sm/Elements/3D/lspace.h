@@ -108,6 +108,8 @@ public:
 
 protected:
     virtual int giveNumberOfIPForMassMtrxIntegration() { return 8; }
+    /// Small strain B-matrix evaluated with fixed size kernels.
+    virtual void computeBmatrixAt(GaussPoint *gp, FloatMatrix &answer, TimeStep *tStep = NULL, int li = 1, int ui = ALL_STRAINS);
 
     /**
      * @name Surface load support
@@ -36,6 +36,7 @@
 #define q27space_h
 
 #include "Elements/structural3delement.h"
+#include "Elements/sumfactorizedelementinterface.h"
 #include "ErrorEstimators/huertaerrorestimator.h"
 #include "zznodalrecoverymodel.h"
 #include "nodalaveragingrecoverymodel.h"
@@ -48,9 +49,11 @@ class FEI3dHexaTriQuad;
 
 /**
  * A 27 node tri-quadratic element for structural analysis.
+ * Small strain internal forces are evaluated by sum factorization (see SumFactorizedElementInterface).
  * @author Mikael Öhman
  */
-class Q27Space : public Structural3DElement, public SPRNodalRecoveryModelInterface, public ZZNodalRecoveryModelInterface, public NodalAveragingRecoveryModelInterface
+class Q27Space : public Structural3DElement, public SPRNodalRecoveryModelInterface, public ZZNodalRecoveryModelInterface, public NodalAveragingRecoveryModelInterface,
+    public SumFactorizedElementInterface
 {
 protected:
     static FEI3dHexaTriQuad interpolation;
@@ -63,6 +66,7 @@ public:
 
     virtual IRResultType initializeFrom(InputRecord *ir);
     virtual Interface *giveInterface(InterfaceType);
+    virtual void giveInternalForcesVector(FloatArray &answer, TimeStep *tStep, int useUpdatedGpRecord = 0);
     virtual int testElementExtension(ElementExtension ext) { return ( ( ext == Element_SurfaceLoadSupport ) ? 1 : 0 ); }
 
     virtual void SPRNodalRecoveryMI_giveSPRAssemblyPoints(IntArray &pap);
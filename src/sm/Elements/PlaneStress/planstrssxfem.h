@@ -63,6 +63,8 @@ public:
 
     virtual const char *giveInputRecordName() const { return _IFT_PlaneStress2dXfem_Name; }
     virtual const char *giveClassName() const { return "PlaneStress2dXfem"; }
+    /// Enrichment changes the B-matrices as the discontinuities evolve.
+    virtual bool providesGeometryCache() { return false; }
     virtual int computeNumberOfDofs();
     virtual void computeGaussPoints();
 
@@ -75,9 +77,14 @@ public:
     virtual void giveDofManDofIDMask(int inode, IntArray &answer) const;
     virtual void computeConstitutiveMatrixAt(FloatMatrix &answer, MatResponseMode rMode, GaussPoint *, TimeStep *tStep);
     virtual void computeStressVector(FloatArray &answer, const FloatArray &strain, GaussPoint *gp, TimeStep *tStep);
+    /// Points are evaluated one by one, using the overloaded computeStressVector and computeConstitutiveMatrixAt.
+    virtual void computeStressVectorBatch(FloatMatrix &answer, const FloatMatrix &strains, const std :: vector< GaussPoint * > &gps, TimeStep *tStep)
+    { StructuralElement :: computeStressVectorBatch(answer, strains, gps, tStep); }
+    virtual void computeConstitutiveMatrixBatch(std :: vector< FloatMatrix > &answer, MatResponseMode rMode, const std :: vector< GaussPoint * > &gps, TimeStep *tStep)
+    { StructuralElement :: computeConstitutiveMatrixBatch(answer, rMode, gps, tStep); }
     virtual void computeStiffnessMatrix(FloatMatrix &answer, MatResponseMode rMode, TimeStep *tStep);
 
-    virtual void computeDeformationGradientVector(FloatArray &answer, GaussPoint *gp, TimeStep *tStep);
+    virtual void computeDeformationGradientVector(FloatArray &answer, GaussPoint *gp, TimeStep *tStep, ValueModeType modeType = VM_Total);
 
     virtual void giveInternalForcesVector(FloatArray &answer, TimeStep *tStep, int useUpdatedGpRecord);
 
@@ -36,6 +36,7 @@
 #define Q9PLANSTRSS_H_
 
 #include "Elements/structural2delement.h"
+#include "Elements/sumfactorizedelementinterface.h"
 #include "zznodalrecoverymodel.h"
 #include "nodalaveragingrecoverymodel.h"
 
@@ -46,11 +47,13 @@ class FEI2dQuadBiQuad;
 
 /**
  * 9-node plane stress element.
+ * Small strain internal forces are evaluated by sum factorization (see SumFactorizedElementInterface).
  *
  * @date May 22, 2013
  * @author Erik Svenning
  */
-class Q9PlaneStress2d : public PlaneStressElement, public ZZNodalRecoveryModelInterface, public NodalAveragingRecoveryModelInterface
+class Q9PlaneStress2d : public PlaneStressElement, public ZZNodalRecoveryModelInterface, public NodalAveragingRecoveryModelInterface,
+    public SumFactorizedElementInterface
 {
 protected:
     static FEI2dQuadBiQuad interpolation;
@@ -65,6 +68,7 @@ public:
     virtual FEInterpolation *giveInterpolation() const;
 
     virtual Interface *giveInterface(InterfaceType it);
+    virtual void giveInternalForcesVector(FloatArray &answer, TimeStep *tStep, int useUpdatedGpRecord = 0);
 
     virtual void NodalAveragingRecoveryMI_computeNodalValue(FloatArray &answer, int node,
                                                             InternalStateType type, TimeStep *tStep);
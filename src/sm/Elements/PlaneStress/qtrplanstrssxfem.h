@@ -65,6 +65,8 @@ public:
 
     virtual const char *giveInputRecordName() const { return _IFT_QTrPlaneStress2dXFEM_Name; }
     virtual const char *giveClassName() const { return "QTrPlaneStress2dXFEM"; }
+    /// Enrichment changes the B-matrices as the discontinuities evolve.
+    virtual bool providesGeometryCache() { return false; }
 
 
     virtual int computeNumberOfDofs();
@@ -77,9 +79,14 @@ public:
     virtual void giveDofManDofIDMask(int inode, IntArray &answer) const;
     virtual void computeConstitutiveMatrixAt(FloatMatrix &answer, MatResponseMode rMode, GaussPoint *, TimeStep *tStep);
     virtual void computeStressVector(FloatArray &answer, const FloatArray &strain, GaussPoint *gp, TimeStep *tStep);
+    /// Points are evaluated one by one, using the overloaded computeStressVector and computeConstitutiveMatrixAt.
+    virtual void computeStressVectorBatch(FloatMatrix &answer, const FloatMatrix &strains, const std :: vector< GaussPoint * > &gps, TimeStep *tStep)
+    { StructuralElement :: computeStressVectorBatch(answer, strains, gps, tStep); }
+    virtual void computeConstitutiveMatrixBatch(std :: vector< FloatMatrix > &answer, MatResponseMode rMode, const std :: vector< GaussPoint * > &gps, TimeStep *tStep)
+    { StructuralElement :: computeConstitutiveMatrixBatch(answer, rMode, gps, tStep); }
     virtual void computeStiffnessMatrix(FloatMatrix &answer, MatResponseMode rMode, TimeStep *tStep);
 
-    virtual void computeDeformationGradientVector(FloatArray &answer, GaussPoint *gp, TimeStep *tStep);
+    virtual void computeDeformationGradientVector(FloatArray &answer, GaussPoint *gp, TimeStep *tStep, ValueModeType modeType = VM_Total);
 
     virtual void giveInternalForcesVector(FloatArray &answer, TimeStep *tStep, int useUpdatedGpRecord);
     virtual void computeConsistentMassMatrix(FloatMatrix &answer, TimeStep *tStep, double &mass, const double *ipDensity = NULL) { XfemStructuralElementInterface :: XfemElementInterface_computeConsistentMassMatrix(answer, tStep, mass, ipDensity); }
@@ -69,6 +69,11 @@ protected:
 
     virtual void computeConstitutiveMatrixAt(FloatMatrix &answer, MatResponseMode rMode, GaussPoint *gp, TimeStep *tStep);
     virtual void computeStressVector(FloatArray &answer, const FloatArray &strain, GaussPoint *gp, TimeStep *tStep);
+    /// Points are evaluated one by one, using the overloaded computeStressVector and computeConstitutiveMatrixAt.
+    virtual void computeStressVectorBatch(FloatMatrix &answer, const FloatMatrix &strains, const std :: vector< GaussPoint * > &gps, TimeStep *tStep)
+    { StructuralElement :: computeStressVectorBatch(answer, strains, gps, tStep); }
+    virtual void computeConstitutiveMatrixBatch(std :: vector< FloatMatrix > &answer, MatResponseMode rMode, const std :: vector< GaussPoint * > &gps, TimeStep *tStep)
+    { StructuralElement :: computeConstitutiveMatrixBatch(answer, rMode, gps, tStep); }
 
     virtual double giveArea();
     virtual void giveNodeCoordinates(FloatArray &x, FloatArray &y);
@@ -68,6 +68,8 @@ public:
 
     virtual const char *giveInputRecordName() const { return _IFT_TrPlaneStress2dXFEM_Name; }
     virtual const char *giveClassName() const { return "TrPlaneStress2dXFEM"; }
+    /// Enrichment changes the B-matrices as the discontinuities evolve.
+    virtual bool providesGeometryCache() { return false; }
 
     virtual int computeNumberOfDofs();
     virtual void computeGaussPoints();
@@ -78,9 +80,14 @@ public:
     virtual void giveDofManDofIDMask(int inode, IntArray &answer) const;
     virtual void computeConstitutiveMatrixAt(FloatMatrix &answer, MatResponseMode rMode, GaussPoint *, TimeStep *tStep);
     virtual void computeStressVector(FloatArray &answer, const FloatArray &strain, GaussPoint *gp, TimeStep *tStep);
+    /// Points are evaluated one by one, using the overloaded computeStressVector and computeConstitutiveMatrixAt.
+    virtual void computeStressVectorBatch(FloatMatrix &answer, const FloatMatrix &strains, const std :: vector< GaussPoint * > &gps, TimeStep *tStep)
+    { StructuralElement :: computeStressVectorBatch(answer, strains, gps, tStep); }
+    virtual void computeConstitutiveMatrixBatch(std :: vector< FloatMatrix > &answer, MatResponseMode rMode, const std :: vector< GaussPoint * > &gps, TimeStep *tStep)
+    { StructuralElement :: computeConstitutiveMatrixBatch(answer, rMode, gps, tStep); }
     virtual void computeStiffnessMatrix(FloatMatrix &answer, MatResponseMode rMode, TimeStep *tStep);
 
-    virtual void computeDeformationGradientVector(FloatArray &answer, GaussPoint *gp, TimeStep *tStep);
+    virtual void computeDeformationGradientVector(FloatArray &answer, GaussPoint *gp, TimeStep *tStep, ValueModeType modeType = VM_Total);
 
     virtual void giveInternalForcesVector(FloatArray &answer, TimeStep *tStep, int useUpdatedGpRecord);
 
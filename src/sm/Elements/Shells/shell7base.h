@@ -46,6 +46,11 @@
 #include "cltypes.h"
 #include <vector>
 
+///@name Input fields for Shell7Base
+//@{
+#define _IFT_Shell7Base_TangentReuseTolerance "tangentreusetol"
+//@}
+
 namespace oofem {
 class BoundaryLoad;
 
@@ -54,6 +59,11 @@ class BoundaryLoad;
 /**
  * This class represent a 7 parameter shell element.
  * Each node has 7 degrees of freedom (displ. vec., director vec., inhomogeneous thickness strain ).
+ *
+ * The B-matrices, generalized strains and lambda matrices of the integration points are cached for the
+ * current solution vector, so the tangent reuses the quantities computed for the internal forces in the same iteration.
+ * With a positive tangent reuse tolerance, the element keeps its last bulk tangent (modified Newton) as long as the relative
+ * change of the generalized strains in all integration points since its computation stays below the tolerance.
  * @todo Add ref. to paper!
  * @author Jim Brouzoulis
  * @date 2012-11-01
@@ -93,6 +103,35 @@ protected:
     virtual Interface *giveInterface(InterfaceType it);
     LayeredCrossSection *layeredCS;
 
+    /// Cached quantities of an integration point.
+    struct PointData {
+        GaussPoint *gp;
+        /// B-matrix and initial contravariant base vectors, depending only on the initial geometry.
+        FloatMatrix B, Gcon;
+        /// Global thickness coordinate.
+        double zeta;
+        /// Generalized strain and lambda^g matrices for the cached solution vector.
+        FloatArray genEps;
+        FloatMatrix lambdaG [ 3 ];
+        /// Product of the first Piola-Kirchhoff stress and the contravariant base vectors from the last internal forces evaluation.
+        FloatMatrix PG;
+        /// Linearized material stiffness from the last tangent evaluation.
+        FloatMatrix A [ 3 ] [ 3 ];
+        /// Generalized strain at which the reusable tangent was computed.
+        FloatArray tangentGenEps;
+    };
+    /// Cached point data for each layer.
+    std :: vector< std :: vector< PointData > >pointData;
+    /// Solution vector for which the generalized strains in pointData are valid.
+    FloatArray pointDataSolVec;
+    /// If the stress products PG in pointData have been computed (by computeSectionalForces) for pointDataSolVec.
+    bool pointDataHasStresses;
+    /// Relative change of the generalized strains below which the last bulk tangent is reused (0 disables reuse).
+    double tangentReuseTol;
+    /// Last bulk tangent and its response mode.
+    FloatMatrix reusableTangent;
+    MatResponseMode reusableTangentMode;
+
     static FEI3dTrQuad  interpolationForCZExport;
     static FEI3dWedgeQuad interpolationForExport;
 
@@ -181,11 +220,30 @@ protected:
     void computePressureTangentMatrix(FloatMatrix &answer, Load *load, const int iSurf, TimeStep *tStep);
     void computeLambdaGMatrices(FloatMatrix lambda [ 3 ], FloatArray &genEps, double zeta);
     void computeLambdaNMatrix(FloatMatrix &lambda, FloatArray &genEps, double zeta);
+    void computeLinearizedStiffness(GaussPoint *gp, StructuralMaterial *mat, TimeStep *tStep, FloatMatrix A [ 3 ] [ 3 ], const FloatMatrix &Gcon);
+
+    /**
+     * Updates the cached point data for the given solution vector.
+     * Geometric quantities are set up when the integration rules change, strain dependent quantities when the solution vector changes.
+     */
+    void updatePointData(const FloatArray &solVec);
+    /**
+     * Gives the bulk tangent stored by storeReusableTangent if tangent reuse is enabled and the generalized strains
+     * of all points (see updatePointData) changed less than the tolerance since it was computed.
+     * @return True if the tangent was reused.
+     */
+    bool giveReusableTangent(FloatMatrix &answer, MatResponseMode rMode);
+    /// Returns true if the point data holds the stress products PG computed for the given solution vector.
+    bool hasPointDataStressesFor(const FloatArray &solVec) const;
+    /// Stores the bulk tangent for reuse, together with the current generalized strains.
+    void storeReusableTangent(const FloatMatrix &tangent, MatResponseMode rMode);
 
     // Internal forces
     virtual void giveInternalForcesVector(FloatArray &answer, TimeStep *tStep, int useUpdatedGpRecord = 0);
     void computeSectionalForces(FloatArray &answer, TimeStep *tStep, FloatArray &solVec, int useUpdatedGpRecord = 0);  
     void computeSectionalForcesAt(FloatArray &sectionalForces, IntegrationPoint *ip, Material *mat, TimeStep *tStep, FloatArray &genEpsC, double zeta);
+    /// Computes the sectional forces from the cached point data, storing the stress product PG in it.
+    void computeSectionalForcesAt(FloatArray &sectionalForces, PointData &data, Material *mat, TimeStep *tStep);
 
     // External forces
     virtual void computeBodyLoadVectorAt(FloatArray &answer, Load *forLoad, TimeStep *tStep, ValueModeType mode);
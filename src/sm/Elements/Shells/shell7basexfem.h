@@ -75,7 +75,14 @@ protected:
 
     // Internal forces
     void giveInternalForcesVector(FloatArray &answer, TimeStep *tStep, int useUpdatedGpRecord);
-    void discComputeSectionalForces(FloatArray &answer, TimeStep *tStep, FloatArray &solVec, FloatArray &solVecD, EnrichmentItem *ei);
+    /**
+     * Computes the internal forces of the discontinuous field of an enrichment item.
+     * The stresses are taken from the point data, which computeSectionalForces must have filled for the same continuous solution vector.
+     * @param answer Internal forces.
+     * @param solVec Continuous solution vector, used to check the point data.
+     * @param ei Enrichment item.
+     */
+    void discComputeSectionalForces(FloatArray &answer, const FloatArray &solVec, EnrichmentItem *ei);
     void computeSectionalForcesAt(FloatArray &sectionalForces, IntegrationPoint *ip, Material *mat, TimeStep *tStep, FloatArray &genEps, double zeta);
     
     double evaluateLevelSet(const FloatArray &lCoords, EnrichmentItem *ei);
@@ -91,7 +98,8 @@ protected:
     virtual void OLDcomputeStiffnessMatrix(FloatMatrix &answer, MatResponseMode rMode, TimeStep *tStep);
     virtual void computeStiffnessMatrix(FloatMatrix &answer, MatResponseMode rMode, TimeStep *tStep);
 
-    virtual void discComputeBulkTangentMatrix(FloatMatrix &KdIJ, IntegrationPoint *ip, EnrichmentItem *eiI, EnrichmentItem *eiJ, int layer, FloatMatrix A [ 3 ] [ 3 ], TimeStep *tStep);
+    virtual void discComputeBulkTangentMatrix(FloatMatrix &KdIJ, const FloatMatrix &BI, const FloatMatrix lambdaI [ 3 ], EnrichmentItem *eiI,
+                                              const FloatMatrix &BJ, const FloatMatrix lambdaJ [ 3 ], EnrichmentItem *eiJ, double dV, FloatMatrix A [ 3 ] [ 3 ]);
     virtual void discComputeStiffness(FloatMatrix &LCC, FloatMatrix &LDD, FloatMatrix &LDC, IntegrationPoint *ip, int layer, FloatMatrix A [ 3 ] [ 3 ], TimeStep *tStep);
     
     double EvaluateEnrFuncInDofMan(int dofManNum, EnrichmentItem *ei);
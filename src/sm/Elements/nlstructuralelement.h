@@ -88,6 +88,17 @@ class NLStructuralElement : public StructuralElement
 protected:
     /// Flag indicating if geometrical nonlinearities apply.
     int nlGeometry;
+    /**
+     * State of the geometry cache: -1 not yet built, 0 disabled, 1 volumes cached, 2 volumes and B-matrices cached.
+     * @see Domain::giveGeometryCacheMode
+     */
+    int geometryCacheState;
+    /// Cached volumes of the integration points of the default integration rule.
+    FloatArray cachedVolumes;
+    /// Cached B-matrices of the default integration rule, stored column-wise one after another in a single block.
+    std :: vector< double >cachedBmatrices;
+    /// Size of each cached B-matrix.
+    int cachedBrows, cachedBcols;
 
 public:
     /**
@@ -97,7 +108,7 @@ public:
      */
     NLStructuralElement(int n, Domain * d);
     /// Destructor.
-    virtual ~NLStructuralElement() { }
+    virtual ~NLStructuralElement();
 
     /**
      * Returns the geometry mode describing the formulation used in the internal work
@@ -213,6 +224,14 @@ public:
       */
     double computeCurrentVolume(TimeStep *tStep);
 
+    /**
+     * Returns true if the element geometry (B-matrices and integration point volumes) depends only on the
+     * initial configuration and may be cached between iterations. Derived classes have to opt in explicitly.
+     */
+    virtual bool providesGeometryCache() { return false; }
+    /// Drops the cached geometry and returns its memory to the domain; it is rebuilt on the next request (e.g. after remeshing moved the nodes).
+    void clearGeometryCache();
+
     // data management
     virtual IRResultType initializeFrom(InputRecord *ir);
     virtual void giveInputRecord(DynamicInputRecord &input);
@@ -222,6 +241,18 @@ public:
 
 protected:
     int checkConsistency();
+    /**
+     * Returns the small strain B-matrix of the default integration rule, using the geometry cache if it is active.
+     * Falls back to computeBmatrixAt otherwise.
+     */
+    void giveCachedBmatrixAt(GaussPoint *gp, FloatMatrix &answer);
+    /**
+     * Returns the volume around integration point of the default integration rule, using the geometry cache if it is active.
+     * Falls back to computeVolumeAround otherwise.
+     */
+    double giveCachedVolumeAround(GaussPoint *gp);
+    /// Fills the geometry cache according to the level requested by the domain and the memory available.
+    void buildGeometryCache();
     /**
      * Computes a matrix which, multiplied by the column matrix of nodal displacements,
      * gives the displacement gradient stored by columns.
@@ -240,6 +271,7 @@ protected:
     friend class XfemStructuralElementInterface;
     friend class MeanDilatationalMethodElementExtensionInterface;
     friend class FbarElementExtensionInterface;
+    friend class SumFactorizedElementInterface;
     friend class BaseMicromorphicElement;
     friend class BaseSecondGradientElement;
 };
@@ -43,6 +43,7 @@
 #include "floatarray.h"
 
 #include <memory>
+#include <vector>
 
 namespace oofem {
 #define ALL_STRAINS -1
@@ -351,6 +352,17 @@ public:
     virtual void computeConstitutiveMatrixAt(FloatMatrix &answer,
                                              MatResponseMode rMode, GaussPoint *gp,
                                              TimeStep *tStep);
+    /**
+     * Computes constitutive matrices of receiver for a batch of integration points.
+     * Default implementation evaluates computeConstitutiveMatrixAt for each point.
+     * @param answer Constitutive matrices, one for each integration point.
+     * @param rMode Material response mode of answer.
+     * @param gps Integration points for which constitutive matrices are computed.
+     * @param tStep Time step.
+     */
+    virtual void computeConstitutiveMatrixBatch(std :: vector< FloatMatrix > &answer,
+                                                MatResponseMode rMode, const std :: vector< GaussPoint * > &gps,
+                                                TimeStep *tStep);
     /// Helper function which returns the structural cross-section for the element.
     StructuralCrossSection *giveStructuralCrossSection();
 
@@ -469,6 +481,16 @@ public:
      * @param tStep Time step.
      */
     virtual void computeStressVector(FloatArray &answer, const FloatArray &strain, GaussPoint *gp, TimeStep *tStep);
+    /**
+     * Computes the stress vectors of receiver for a batch of integration points at once,
+     * which allows the cross section and material to share the work between the points.
+     * Default implementation evaluates computeStressVector for each point.
+     * @param answer Stress vectors, one column per integration point.
+     * @param strains Strain vectors, one column per integration point.
+     * @param gps Integration points.
+     * @param tStep Time step.
+     */
+    virtual void computeStressVectorBatch(FloatMatrix &answer, const FloatMatrix &strains, const std :: vector< GaussPoint * > &gps, TimeStep *tStep);
 
     /**
      * Computes the geometrical matrix of receiver in given integration point.
@@ -0,0 +1,120 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef sumfactorizedelementinterface_h
+#define sumfactorizedelementinterface_h
+
+#include "interface.h"
+#include "floatarray.h"
+#include "floatmatrix.h"
+#include "matresponsemode.h"
+#include "sumfactorization.h"
+
+namespace oofem {
+class NLStructuralElement;
+class TimeStep;
+class Domain;
+class UnknownNumberingScheme;
+
+/**
+ * Element kernel interface for small strain elements with tensor product interpolations.
+ * Strains in the integration points and the internal forces are evaluated by sum factorization
+ * (see SumFactorizationKernel) instead of forming the B-matrix in every integration point.
+ * The same kernel provides the matrix-free product of the element stiffness matrix with a vector.
+ *
+ * The kernel applies to small strain elements in 3d or plane stress mode integrated by a single tensor product Gauss rule;
+ * the element is expected to fall back to its standard implementation otherwise (see SFEI_isApplicable).
+ * The inverse Jacobians and volumes of the integration points are computed once from the initial geometry.
+ */
+class SumFactorizedElementInterface : public Interface
+{
+protected:
+    /// Sum factorization kernel of the element.
+    SumFactorizationKernel kernel;
+    /// State of the kernel: -1 not yet initialized, 0 not applicable, 1 ready.
+    int kernelState;
+    /// Inverse Jacobians of the integration points, @f$ \partial\xi_d/\partial x_e @f$ stored column-wise (one column per point).
+    FloatMatrix invJacobians;
+    /// Volumes of the integration points.
+    FloatArray volumes;
+
+public:
+    SumFactorizedElementInterface();
+    virtual ~SumFactorizedElementInterface() { }
+
+    /**
+     * Checks whether the sum factorized kernel can be used for the given element.
+     * The kernel is set up on the first call.
+     */
+    bool SFEI_isApplicable(NLStructuralElement *elem);
+    /**
+     * Evaluates the internal forces of the element, computing the stresses in all integration points.
+     * @param answer Internal forces vector.
+     * @param tStep Time step.
+     * @param elem Element.
+     */
+    void SFEI_giveInternalForcesVector(FloatArray &answer, TimeStep *tStep, NLStructuralElement *elem);
+    /**
+     * Evaluates the product of the element stiffness matrix with a vector without forming the matrix.
+     * @param answer Product @f$ K_e u @f$.
+     * @param u Element vector.
+     * @param rMode Material response mode.
+     * @param tStep Time step.
+     * @param elem Element.
+     */
+    void SFEI_applyStiffnessMatrix(FloatArray &answer, const FloatArray &u, MatResponseMode rMode, TimeStep *tStep, NLStructuralElement *elem);
+
+    /**
+     * Evaluates the product of the global stiffness matrix with a vector, element by element.
+     * Elements providing this interface use the matrix-free kernel, other elements multiply by their stiffness matrix.
+     * @param answer Product, sized by the number of equations of the scheme.
+     * @param u Vector to multiply.
+     * @param rMode Material response mode.
+     * @param tStep Time step.
+     * @param d Domain.
+     * @param s Numbering scheme of the equations.
+     */
+    static void applyStiffnessMatrix(FloatArray &answer, const FloatArray &u, MatResponseMode rMode, TimeStep *tStep,
+                                     Domain *d, const UnknownNumberingScheme &s);
+
+protected:
+    /// Sets up the kernel and the geometry of the integration points.
+    void SFEI_initialize(NLStructuralElement *elem);
+    /// Computes the strain vectors (one column per integration point) from the element vector.
+    void SFEI_computeStrains(FloatMatrix &answer, const FloatArray &u);
+    /// Integrates the stress vectors (one column per integration point) into nodal forces.
+    void SFEI_integrateStresses(FloatArray &answer, const FloatMatrix &stresses);
+};
+} // end namespace oofem
+#endif // sumfactorizedelementinterface_h
@@ -40,6 +40,9 @@
 #include "sparsemtrxtype.h"
 
 #define _IFT_LinearStatic_Name "linearstatic"
+#define _IFT_LinearStatic_matrixFree "matrixfree"
+#define _IFT_LinearStatic_matrixFreeTol "mftol"
+#define _IFT_LinearStatic_matrixFreeMaxIter "mfmaxiter"
 
 namespace oofem {
 class SparseMtrx;
@@ -58,6 +61,10 @@ class SparseMtrx;
  * - Creating Numerical method for solving @f$ K\cdot x=b @f$.
  * - Interfacing Numerical method to Elements.
  * - Managing time steps.
+ *
+ * With the matrixfree option the stiffness matrix is not assembled; the system is solved by the conjugate gradient
+ * method using the element by element product of the stiffness matrix with a vector
+ * (see SumFactorizedElementInterface :: applyStiffnessMatrix).
  */
 class LinearStatic : public StructuralEngngModel
 {
@@ -73,6 +80,16 @@ protected:
 
     int initFlag;
 
+    /// Flag indicating that the system is solved by matrix-free conjugate gradients.
+    bool matrixFree;
+    /// Relative residual tolerance of the matrix-free solver.
+    double matrixFreeTol;
+    /// Maximum number of iterations of the matrix-free solver.
+    int matrixFreeMaxIter;
+
+    /// Solves the system by conjugate gradients using the matrix-free stiffness product.
+    void solveMatrixFree(TimeStep *tStep);
+
 public:
     LinearStatic(int i, EngngModel * _master = NULL);
     virtual ~LinearStatic();
@@ -40,6 +40,9 @@
 #include "floatmatrix.h"
 #include "sparselinsystemnm.h"
 #include "sparsemtrxtype.h"
+#include "intarray.h"
+
+#include <vector>
 
 #define LOCAL_ZERO_MASS_REPLACEMENT 1
 
@@ -121,6 +124,12 @@ protected:
     /// Product of p^tM^(-1)p; where p is reference load vector.
     double pMp;
 
+    /**
+     * Elements grouped by colors, elements of one color share no equations.
+     * The internal forces of the elements of one color are evaluated and assembled concurrently.
+     */
+    std :: vector< IntArray >elementColors;
+
     SparseMtrx *massMatrixConsistent;
     LinSystSolverType solverType;
     SparseMtrxType sparseMtrxType;
@@ -177,6 +186,13 @@ protected:
      */
     void computeMassMtrx(FloatArray &mass, double &maxOm, TimeStep *tStep);
     void computeMassMtrx2(FloatMatrix &mass, double &maxOm, TimeStep *tStep);
+    /**
+     * Evaluates the internal forces with the elements processed color by color (see buildElementColoring),
+     * so that the threads assemble without synchronization.
+     */
+    virtual void giveInternalForces(FloatArray &answer, bool normFlag, int di, TimeStep *tStep);
+    /// Greedy coloring of the elements such that no two elements of one color contribute to the same equation.
+    void buildElementColoring();
 
 public:
     virtual int estimateMaxPackSize(IntArray &commMap, DataStream &buff, int packUnpackType);
@@ -74,6 +74,9 @@ protected:
 
     bool mRecomputeStepAfterPropagation;
 
+    /// Number of iterations of the nonlinear solver in the last solved step.
+    int currentIterations;
+
 public:
     StaticStructural(int i, EngngModel * _master = NULL);
     virtual ~StaticStructural();
@@ -97,6 +100,8 @@ public:
     
     virtual fMode giveFormulation() { return TL; }
 
+    virtual int giveCurrentNumberOfIterations() { return currentIterations; }
+
     void setSolution(TimeStep *tStep, const FloatArray &vectorToStore);
 
     virtual bool requiresEquationRenumbering(TimeStep *tStep);
@@ -121,6 +121,9 @@ public:
     virtual void giveRealStressVector_3d(FloatArray &answer, GaussPoint *gp,
                                          const FloatArray &reducedStrain, TimeStep *tStep);
 
+    /// Stress is linear in strain, reduced stress states are obtained by condensation of the 3d stiffness.
+    virtual bool hasCondensableStressResponse() { return true; }
+
     virtual const char *giveInputRecordName() const { return _IFT_TrabBoneEmbed_Name; }
     virtual const char *giveClassName() const { return "TrabBoneEmbed"; }
 
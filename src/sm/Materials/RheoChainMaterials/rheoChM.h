@@ -144,6 +144,8 @@ protected:
     double alphaOne, alphaTwo;
     /// Time for which the partial moduli of individual units have been evaluated.
     double EparValTime;
+    /// Time increment for which the step coefficients of individual units have been evaluated.
+    double stepCoeffDeltaT;
 
     /// Time from which the model should give a good approximation. Optional field. Default value is 0.1 [day].
     double begOfTimeOfInterest; // local one or taken from e-model
@@ -156,6 +158,10 @@ protected:
     //FloatArray relaxationTimes;
     /// Characteristic times of individual units (relaxation or retardation times).
     FloatArray charTimes;
+    /// Decay factors exp(-dt/tau) of individual units for time increment stepCoeffDeltaT.
+    FloatArray betaVal;
+    /// Integration factors (1-exp(-dt/tau))*tau/dt of individual units for time increment stepCoeffDeltaT.
+    FloatArray lambdaVal;
     /// Times at which the errors are evaluated if the least-square method is used.
     FloatArray discreteTimeScale;
 
@@ -343,6 +349,16 @@ protected:
     /// Access to partial modulus of a given unit
     double giveEparModulus(int iChain);
 
+    /**
+     * Gives the decay and integration factors of individual units (chartime exponents equal to 1).
+     * They depend only on the time increment, so they are computed once and shared by all integration points.
+     * Thread safe, the factors are copied to the given arrays.
+     * @param[out] beta Decay factors exp(-dt/tau) of individual units.
+     * @param[out] lambda Integration factors (1-exp(-dt/tau))*tau/dt of individual units.
+     * @param deltaT Time increment.
+     */
+    void giveStepCoefficients(FloatArray &beta, FloatArray &lambda, double deltaT);
+
     /// Evaluation of characteristic times
     virtual void computeCharTimes();
 
@@ -44,12 +44,16 @@
 #include "Materials/linearelasticmaterial.h"
 #include "../sm/Materials/structuralmaterial.h"
 #include "../sm/Materials/structuralms.h"
+#include "materialstatestorage.h"
+
+#include <memory>
 
 ///@name Input fields for IsotropicDamageMaterial
 //@{
 #define _IFT_IsotropicDamageMaterial_talpha "talpha"
 #define _IFT_IsotropicDamageMaterial_maxOmega "maxomega"
 #define _IFT_IsotropicDamageMaterial_permstrain "ps"
+#define _IFT_IsotropicDamageMaterial_contiguousState "contiguousstate" ///< Keeps history variables in contiguous storage
 //@}
 
 namespace oofem {
@@ -92,6 +96,12 @@ protected:
     double tempDissWork;
 #endif
 
+    /**
+     * View of history variables in contiguous storage of the material, if attached.
+     * The kappa, damage (and work densities) are then kept in the storage instead of the members above.
+     */
+    MaterialStateView state;
+
 public:
     /// Constructor
     IsotropicDamageMaterialStatus(int n, Domain *d, GaussPoint *g);
@@ -100,18 +110,23 @@ public:
 
     virtual void printOutputAt(FILE *file, TimeStep *tStep);
 
+    /// Indices of history variables in contiguous storage.
+    enum StateValue { SV_Kappa, SV_Damage, SV_StressWork, SV_DissWork, SV_Size };
+    /// Moves history variables of receiver into given storage.
+    void attachStateStorage(std :: shared_ptr< MaterialStateStorage >storage);
+
     /// Returns the last equilibrated scalar measure of the largest strain level.
-    double giveKappa() { return kappa; }
+    double giveKappa() { return state.isAttached() ? state.giveCommitted(SV_Kappa) : kappa; }
     /// Returns the temp. scalar measure of the largest strain level.
-    double giveTempKappa() { return tempKappa; }
+    double giveTempKappa() { return state.isAttached() ? state.giveTemp(SV_Kappa) : tempKappa; }
     /// Sets the temp scalar measure of the largest strain level to given value.
-    void setTempKappa(double newKappa) { tempKappa = newKappa; }
+    void setTempKappa(double newKappa) { if ( state.isAttached() ) { state.setTemp(SV_Kappa, newKappa); } else { tempKappa = newKappa; } }
     /// Returns the last equilibrated damage level.
-    double giveDamage() { return damage; }
+    double giveDamage() { return state.isAttached() ? state.giveCommitted(SV_Damage) : damage; }
     /// Returns the temp. damage level.
-    double giveTempDamage() { return tempDamage; }
+    double giveTempDamage() { return state.isAttached() ? state.giveTemp(SV_Damage) : tempDamage; }
     /// Sets the temp damage level to given value.
-    void setTempDamage(double newDamage) { tempDamage = newDamage; }
+    void setTempDamage(double newDamage) { if ( state.isAttached() ) { state.setTemp(SV_Damage, newDamage); } else { tempDamage = newDamage; } }
 
     /// Returns characteristic length stored in receiver.
     double giveLe() { return le; }
@@ -128,17 +143,17 @@ public:
 
 #ifdef keep_track_of_dissipated_energy
     /// Returns the density of total work of stress on strain increments.
-    double giveStressWork() { return stressWork; }
+    double giveStressWork() { return state.isAttached() ? state.giveCommitted(SV_StressWork) : stressWork; }
     /// Returns the temp density of total work of stress on strain increments.
-    double giveTempStressWork() { return tempStressWork; }
+    double giveTempStressWork() { return state.isAttached() ? state.giveTemp(SV_StressWork) : tempStressWork; }
     /// Sets the density of total work of stress on strain increments to given value.
-    void setTempStressWork(double w) { tempStressWork = w; }
+    void setTempStressWork(double w) { if ( state.isAttached() ) { state.setTemp(SV_StressWork, w); } else { tempStressWork = w; } }
     /// Returns the density of dissipated work.
-    double giveDissWork() { return dissWork; }
+    double giveDissWork() { return state.isAttached() ? state.giveCommitted(SV_DissWork) : dissWork; }
     /// Returns the density of temp dissipated work.
-    double giveTempDissWork() { return tempDissWork; }
+    double giveTempDissWork() { return state.isAttached() ? state.giveTemp(SV_DissWork) : tempDissWork; }
     /// Sets the density of dissipated work to given value.
-    void setTempDissWork(double w) { tempDissWork = w; }
+    void setTempDissWork(double w) { if ( state.isAttached() ) { state.setTemp(SV_DissWork, w); } else { tempDissWork = w; } }
     /// Computes the increment of total stress work and of dissipated work.
     void computeWork(GaussPoint *gp);
 #endif
@@ -182,6 +197,9 @@ protected:
      */
     enum loaUnloCriterium { idm_strainLevelCR, idm_damageLevelCR } llcriteria;
 
+    /// Contiguous storage of history variables of all points, if requested.
+    std :: shared_ptr< MaterialStateStorage >stateStorage;
+
 public:
     /// Constructor
     IsotropicDamageMaterial(int n, Domain *d);
@@ -201,8 +219,20 @@ public:
                                                GaussPoint *gp,
                                                TimeStep *tStep);
 
+    /**
+     * The 3d stress is (1-omega) times the elastic stress and the secant stiffness is scaled alike,
+     * so the shell stress control (which is not routed through giveRealStressVector) is solved by condensation.
+     */
+    virtual bool hasCondensableStressResponse() { return true; }
+
     virtual void giveRealStressVector(FloatArray &answer,  GaussPoint *gp,
                                       const FloatArray &reducedStrain, TimeStep *tStep);
+    /**
+     * Batched stress evaluation. The elastic stiffness of the undamaged material is evaluated
+     * once for the batch, the damage is evaluated point by point.
+     */
+    virtual void giveRealStressVectorBatch(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps,
+                                           const FloatMatrix &reducedStrains, TimeStep *tStep);
 
     virtual void giveRealStressVector_3d(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep)
     { this->giveRealStressVector(answer, gp, reducedE, tStep); }
@@ -257,8 +287,12 @@ public:
     virtual void giveInputRecord(DynamicInputRecord &input);
 
     MaterialStatus *CreateStatus(GaussPoint *gp) const { return new IsotropicDamageMaterialStatus(1, domain, gp); }
+    virtual MaterialStatus *giveStatus(GaussPoint *gp) const;
 
 protected:
+    /// Attaches newly created status to contiguous state storage of receiver, if used.
+    void attachStateStorage(MaterialStatus *status) const;
+
     /**
      * Abstract service allowing to perform some initialization, when damage first appear.
      * @param kappa Scalar measure of strain level.
@@ -267,6 +301,25 @@ protected:
      */
     virtual void initDamaged(double kappa, FloatArray &totalStrainVector, GaussPoint *gp) { }
 
+    /**
+     * Evaluates the temporary values of the history variable and damage for given stress dependent strain,
+     * according to the loading/unloading criterion.
+     * @param[out] tempKappa Temporary value of the history variable.
+     * @param[out] omega Temporary value of the damage.
+     * @param strain Stress dependent part of the strain vector.
+     * @param gp Integration point.
+     * @param tStep Time step.
+     */
+    void computeDamageState(double &tempKappa, double &omega, FloatArray &strain, GaussPoint *gp, TimeStep *tStep);
+    /**
+     * Computes the stress from the stress dependent strain, the elastic stiffness and the temporary damage
+     * and updates the status of the integration point.
+     */
+    void computeDamagedStress(FloatArray &answer, FloatArray &strain, const FloatMatrix &de, double tempKappa, double omega,
+                              const FloatArray &totalStrain, GaussPoint *gp);
+    /// Stores the temporary strain, stress and damage state of the integration point.
+    void updateDamagedStatus(const FloatArray &stress, double tempKappa, double omega, const FloatArray &totalStrain, GaussPoint *gp);
+
     /**
      * Returns the value of derivative of damage function
      * wrt damage-driving variable kappa corresponding
@@ -132,6 +132,18 @@ public:
     /// Returns the bulk elastic modulus @f$ K = \frac{E}{3(1-2\nu)} @f$.
     double giveBulkModulus() { return E / ( 3. * ( 1. - 2. * nu ) ); }
 
+    /**
+     * Batched stress evaluation. The elastic stiffness does not depend on integration point,
+     * it is evaluated once for the batch and applied to all points by single matrix product.
+     */
+    virtual void giveRealStressVectorBatch(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps,
+                                           const FloatMatrix &reducedStrains, TimeStep *tStep);
+    virtual void giveStiffnessMatrixBatch(std :: vector< FloatMatrix > &answer, MatResponseMode mode,
+                                          const std :: vector< GaussPoint * > &gps, TimeStep *tStep);
+
+    virtual FloatMatrixF< 6, 6 >give3dStiffnessMatrixF(GaussPoint *gp, TimeStep *tStep);
+    virtual FloatMatrixF< 3, 3 >givePlaneStressStiffnessMatrixF(GaussPoint *gp, TimeStep *tStep);
+
     virtual void give3dMaterialStiffnessMatrix(FloatMatrix &answer,
                                                MatResponseMode,
                                                GaussPoint *gp,
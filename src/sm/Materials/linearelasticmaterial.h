@@ -36,6 +36,8 @@
 #define linearelasticmaterial_h
 
 #include "../sm/Materials/structuralmaterial.h"
+#include "floatarrayf.h"
+#include "floatmatrixf.h"
 
 namespace oofem {
 /**
@@ -62,6 +64,9 @@ public:
     /// Destructor.
     virtual ~LinearElasticMaterial() { }
 
+    /// Stress is linear in strain, reduced stress states are obtained by condensation of the 3d stiffness.
+    virtual bool hasCondensableStressResponse() { return true; }
+
     virtual void giveRealStressVector_3d(FloatArray &answer, GaussPoint *gp, const FloatArray &strain, TimeStep *tStep);
     virtual void giveRealStressVector_PlaneStrain(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedStrain, TimeStep *tStep);
     virtual void giveRealStressVector_3dDegeneratedShell(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedF, TimeStep *tStep);
@@ -73,6 +78,15 @@ public:
     virtual void giveRealStressVector_Fiber(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep);
     virtual void giveRealStressVector_AxisymMembrane1d(FloatArray &answer, GaussPoint *gp, const FloatArray &dStrain, TimeStep *tStep);
 
+    /**
+     * Returns the 3d elastic stiffness as a fixed size matrix.
+     * The default implementation converts give3dMaterialStiffnessMatrix; models with a closed form stiffness
+     * override it so that the stress evaluation does not allocate memory.
+     */
+    virtual FloatMatrixF< 6, 6 >give3dStiffnessMatrixF(GaussPoint *gp, TimeStep *tStep);
+    /// Returns the plane stress elastic stiffness as a fixed size matrix, see give3dStiffnessMatrixF.
+    virtual FloatMatrixF< 3, 3 >givePlaneStressStiffnessMatrixF(GaussPoint *gp, TimeStep *tStep);
+
     virtual void giveEshelbyStressVector_PlaneStrain(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedF, TimeStep *tStep);
     double giveEnergyDensity(GaussPoint *gp, TimeStep *tStep);
 
@@ -106,6 +106,8 @@ public:
 
     virtual void giveRealStressVector_3d(FloatArray &answer, GaussPoint *gp,
                                          const FloatArray &reducedStrain, TimeStep *tStep);
+    virtual void giveRealStressVectorFromProjections(FloatArray &answer, GaussPoint *gp, const FloatArray &totalStrain,
+                                                     const FloatArray &mPlaneStrains, TimeStep *tStep);
     virtual void give3dMaterialStiffnessMatrix(FloatMatrix &answer,
                                                MatResponseMode mode,
                                                GaussPoint *gp,
@@ -37,6 +37,7 @@
 
 #include "../sm/Materials/structuralmaterial.h"
 #include "matconst.h"
+#include "floatmatrix.h"
 
 ///@name Input fields for MicroplaneMaterial
 //@{
@@ -88,6 +89,12 @@ protected:
      * Due to symmetry, compressed form is stored.
      */
     double L [ MAX_NUMBER_OF_MICROPLANES ] [ 6 ];
+    /**
+     * Projection tensors N, M and L of all microplanes stacked by rows (3*numberOfMicroplanes x 6).
+     * Strain components on all microplanes follow from a single product with the macro strain,
+     * the homogenization of microplane stresses from a single product with its transpose.
+     */
+    FloatMatrix projectionMatrix;
 
     /// Young's modulus
     double E;
@@ -145,6 +152,29 @@ public:
      */
     void computeStrainVectorComponents(FloatArray &answer, Microplane *mplane,
                                        const FloatArray &macroStrain);
+    /**
+     * Computes the normal and shear (m and l direction) strain components on all microplanes.
+     * @param answer Projected strains, ordered as normal components of all microplanes,
+     * followed by m-shear and l-shear components (size 3*numberOfMicroplanes).
+     * @param macroStrain Macro strain vector (full 3d form).
+     */
+    void computeMicroplaneStrains(FloatArray &answer, const FloatArray &macroStrain)
+    { answer.beProductOf(projectionMatrix, macroStrain); }
+    /**
+     * Homogenizes the microplane stresses, i.e. integrates N*sn + M*sm + L*sl over all microplanes.
+     * @param answer Macro stress vector (without the factor 6 of the hemisphere integration).
+     * @param weightedStresses Microplane stresses multiplied by integration weights,
+     * ordered as in computeMicroplaneStrains.
+     */
+    void homogenizeMicroplaneStresses(FloatArray &answer, const FloatArray &weightedStresses)
+    { answer.beTProductOf(projectionMatrix, weightedStresses); }
+    /**
+     * Computes the real stress vector for given macro strain and its projections onto all microplanes.
+     * Default implementation ignores the projections and calls giveRealStressVector_3d.
+     */
+    virtual void giveRealStressVectorFromProjections(FloatArray &answer, GaussPoint *gp, const FloatArray &totalStrain,
+                                                     const FloatArray &mPlaneStrains, TimeStep *tStep)
+    { this->giveRealStressVector_3d(answer, gp, totalStrain, tStep); }
 
 
     /**
@@ -180,6 +210,13 @@ public:
                                                GaussPoint *gp,
                                                TimeStep *tStep);
 
+    /**
+     * Batched stress evaluation. The strains of all points of the batch are projected
+     * onto all microplanes by a single matrix product.
+     */
+    virtual void giveRealStressVectorBatch(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps,
+                                           const FloatMatrix &reducedStrains, TimeStep *tStep);
+
     virtual contextIOResultType saveIPContext(DataStream &stream, ContextMode mode, GaussPoint *gp);
     virtual contextIOResultType restoreIPContext(DataStream &stream, ContextMode mode, GaussPoint *gp);
 
@@ -61,6 +61,8 @@ public:
 
     virtual void giveRealStressVector_3d(FloatArray &answer, GaussPoint *gp,
                                       const FloatArray &reducedStrain, TimeStep *tStep);
+    virtual void giveRealStressVectorFromProjections(FloatArray &answer, GaussPoint *gp, const FloatArray &totalStrain,
+                                                     const FloatArray &mPlaneStrains, TimeStep *tStep);
 
 
     /**
@@ -104,6 +104,15 @@ public:
     virtual ~MisesMat();
 
     void performPlasticityReturn(GaussPoint *gp, const FloatArray &totalStrain);
+    /// Computes the deviatoric and volumetric elastic trial stress (3d).
+    void computeTrialStress(FloatArray &trialStressDev, double &trialStressVol, const FloatArray &totalStrain, const FloatArray &plStrain);
+    /**
+     * Performs the 3d radial return from the given trial state and stores the result in the temporary status.
+     * @param gp Integration point.
+     * @param trialStressDev Deviatoric trial stress, scaled to the returned deviatoric stress on output.
+     * @param trialStressVol Volumetric trial stress.
+     */
+    void performRadialReturn(GaussPoint *gp, FloatArray &trialStressDev, double trialStressVol);
     void performPlasticityReturn_PlaneStress(GaussPoint *gp, const FloatArray &totalStrain);
     double computeDamage(GaussPoint *gp, TimeStep *tStep);
     double computeDamageParam(double tempKappa);
@@ -136,6 +145,12 @@ public:
     virtual void giveRealStressVector_3d(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep);
     virtual void giveRealStressVector_PlaneStress(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep);
     virtual void giveRealStressVector_1d(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep);
+    /**
+     * Batched stress evaluation in 3d. The elastic predictor and the radial return are shared with
+     * giveRealStressVector_3d, the loop avoids the per point dispatch and temporary copies.
+     */
+    virtual void giveRealStressVectorBatch(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps,
+                                           const FloatMatrix &reducedStrains, TimeStep *tStep);
 
     double computeYieldStress(double kappa);
     double computeYieldStressPrime(double kappa);
@@ -181,6 +196,9 @@ protected:
 
     double dGamma;
 
+    /// Sensitivity of the cumulative plastic strain increment to the equivalent trial stress, from the linearized return (3d).
+    double dKappaDTrialStress;
+
 
 public:
     MisesMatStatus(int n, Domain * d, GaussPoint * g);
@@ -217,6 +235,9 @@ public:
 
     void setDGamma(double dg) {dGamma = dg;}
     double giveDGamma() { return dGamma;}
+
+    void setDKappaDTrialStress(double value) { dKappaDTrialStress = value; }
+    double giveDKappaDTrialStress() { return dKappaDTrialStress; }
     
     void setTempCumulativePlasticStrain(double value) { tempKappa = value; }
     /****************************************/
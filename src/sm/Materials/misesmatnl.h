@@ -157,6 +157,9 @@ public:
 
     virtual void giveRealStressVector_3d(FloatArray &answer,  GaussPoint *gp, const FloatArray &strainVector, TimeStep *tStep);
     virtual void giveRealStressVector_1d(FloatArray &answer,  GaussPoint *gp, const FloatArray &strainVector, TimeStep *tStep);
+    virtual void giveRealStressVectorBatch(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps,
+                                           const FloatMatrix &reducedStrains, TimeStep *tStep)
+    { StructuralMaterial :: giveRealStressVectorBatch(answer, gps, reducedStrains, tStep); }
 
     virtual void updateBeforeNonlocAverage(const FloatArray &strainVector, GaussPoint *gp, TimeStep *tStep);
 
@@ -144,7 +144,19 @@ public:
                                                     MatResponseMode mode, GaussPoint *gp,
                                                     TimeStep *tStep);
 
+    /**
+     * Batched stress evaluation. The stiffness depends on the integration point only through the orientation
+     * of the material axes, which is the same for all points of an element (or, for shell coordinate systems,
+     * for all layers of an in-plane point). It is evaluated once for each such group of consecutive points.
+     */
+    virtual void giveRealStressVectorBatch(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps,
+                                           const FloatMatrix &reducedStrains, TimeStep *tStep);
+    virtual void giveStiffnessMatrixBatch(std :: vector< FloatMatrix > &answer, MatResponseMode mode,
+                                          const std :: vector< GaussPoint * > &gps, TimeStep *tStep);
+
 protected:
+    /// Returns true if the material axes, and thus the stiffness of the receiver, are the same in both points.
+    bool hasSameMaterialAxes(GaussPoint *gp1, GaussPoint *gp2);
     void giveTensorRotationMatrix(FloatMatrix &answer, GaussPoint *gp);
     void giveRotationMatrix(FloatMatrix &answer, GaussPoint *gp);
 
@@ -0,0 +1,230 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef returnmappingsolver_h
+#define returnmappingsolver_h
+
+#include <cmath>
+#include <algorithm>
+
+namespace oofem {
+/**
+ * Local Newton solver for the stress return of plasticity models.
+ *
+ * The unknowns of the return (plastic multipliers, hardening variables, stress components)
+ * are held in fixed-size arrays of dimension N, known at compile time, so the iteration
+ * does not allocate. The residual is supplied by the model as a functor
+ * @code
+ * void operator() (const double x[N], double r[N], double jac[N][N]);
+ * @endcode
+ * evaluating the residual and its Jacobian at x. The Newton step is safeguarded by optional
+ * bounds on the unknowns and by a backtracking line search on the residual norm.
+ * After convergence, the factorized Jacobian is kept, so the model can assemble
+ * the consistent tangent by solveWithJacobian (if the Jacobian at the solution is regular,
+ * see hasJacobian). The iteration counts are kept for diagnostics.
+ */
+template< int N >
+class ReturnMappingSolver
+{
+protected:
+    /// Tolerance on the residual norm.
+    double tolerance;
+    /// Maximum number of Newton iterations.
+    int maxIterations;
+    /// Maximum number of step halvings in one line search.
+    int maxLineSearchCuts;
+    /// Lower and upper bounds of the unknowns.
+    double lowerBound [ N ], upperBound [ N ];
+
+    /// LU factors of the last Jacobian (with row pivots).
+    double lu [ N ] [ N ];
+    int pivots [ N ];
+    /// Flag indicating that lu holds the factors of the Jacobian at the last solution.
+    bool factorized;
+
+    /// Number of Newton iterations of the last solve.
+    int iterations;
+    /// Total number of line search cuts of the last solve.
+    int lineSearchCuts;
+    /// Residual norm at the end of the last solve.
+    double residualNorm;
+
+public:
+    ReturnMappingSolver(double tolerance, int maxIterations = 100, int maxLineSearchCuts = 10) :
+        tolerance(tolerance), maxIterations(maxIterations), maxLineSearchCuts(maxLineSearchCuts),
+        factorized(false), iterations(0), lineSearchCuts(0), residualNorm(0.)
+    {
+        for ( int i = 0; i < N; i++ ) {
+            lowerBound [ i ] = -HUGE_VAL;
+            upperBound [ i ] = HUGE_VAL;
+        }
+    }
+
+    /// Sets the admissible range of the i-th unknown (0-based).
+    void setBounds(int i, double lower, double upper)
+    {
+        lowerBound [ i ] = lower;
+        upperBound [ i ] = upper;
+    }
+
+    int giveNumberOfIterations() const { return iterations; }
+    int giveNumberOfLineSearchCuts() const { return lineSearchCuts; }
+    double giveResidualNorm() const { return residualNorm; }
+
+    /**
+     * Solves the return mapping equations.
+     * @param x On input the initial guess, on output the solution.
+     * @param residual Functor evaluating the residual and Jacobian.
+     * @return True if the residual norm dropped below the tolerance. A singular Jacobian at the solution
+     * (e.g. when the initial guess already satisfies the residual) does not make the solve fail.
+     */
+    template< class Residual >
+    bool solve(double x [ N ], Residual &residual)
+    {
+        double r [ N ], jac [ N ] [ N ], dx [ N ], xNew [ N ], rNew [ N ];
+
+        iterations = lineSearchCuts = 0;
+        factorized = false;
+        residual(x, r, jac);
+        residualNorm = norm(r);
+
+        while ( !( residualNorm <= tolerance ) ) {
+            if ( std :: isnan(residualNorm) || ++iterations > maxIterations || !factorize(jac) ) {
+                return false;
+            }
+
+            // Newton direction, truncated to the admissible range
+            for ( int i = 0; i < N; i++ ) {
+                dx [ i ] = -r [ i ];
+            }
+            backSubstitute(dx);
+            for ( int i = 0; i < N; i++ ) {
+                dx [ i ] = std :: min(std :: max(x [ i ] + dx [ i ], lowerBound [ i ]), upperBound [ i ]) - x [ i ];
+            }
+
+            // backtracking on the residual norm, the full step is tried first
+            double alpha = 1.;
+            for ( int cut = 0; ; cut++ ) {
+                for ( int i = 0; i < N; i++ ) {
+                    xNew [ i ] = x [ i ] + alpha * dx [ i ];
+                }
+                residual(xNew, rNew, jac);
+                double normNew = norm(rNew);
+                if ( normNew < ( 1. - 1.e-4 * alpha ) * residualNorm || cut == maxLineSearchCuts ) {
+                    residualNorm = normNew;
+                    break;
+                }
+                alpha *= 0.5;
+                lineSearchCuts++;
+            }
+
+            std :: copy(xNew, xNew + N, x);
+            std :: copy(rNew, rNew + N, r);
+        }
+
+        // keep the factors of the Jacobian at the solution for the consistent tangent
+        factorized = factorize(jac);
+        return true;
+    }
+
+    /// Returns true if the Jacobian at the solution of the last solve is regular and factorized.
+    bool hasJacobian() const { return factorized; }
+
+    /**
+     * Overwrites b by J^{-1} b, with J the Jacobian at the solution of the last solve.
+     * Used for the linearization of the return, i.e. the consistent tangent.
+     * Valid only if hasJacobian() returns true.
+     */
+    void solveWithJacobian(double b [ N ]) const { backSubstitute(b); }
+
+protected:
+    static double norm(const double r [ N ])
+    {
+        double sum = 0.;
+        for ( int i = 0; i < N; i++ ) {
+            sum += r [ i ] * r [ i ];
+        }
+        return sqrt(sum);
+    }
+
+    /// LU factorization with partial pivoting, returns false for a singular matrix.
+    bool factorize(const double a [ N ] [ N ])
+    {
+        std :: copy(& a [ 0 ] [ 0 ], & a [ 0 ] [ 0 ] + N * N, & lu [ 0 ] [ 0 ]);
+        for ( int k = 0; k < N; k++ ) {
+            int p = k;
+            for ( int i = k + 1; i < N; i++ ) {
+                if ( fabs(lu [ i ] [ k ]) > fabs(lu [ p ] [ k ]) ) {
+                    p = i;
+                }
+            }
+            pivots [ k ] = p;
+            if ( lu [ p ] [ k ] == 0. ) {
+                return false;
+            }
+            if ( p != k ) {
+                for ( int j = 0; j < N; j++ ) {
+                    std :: swap(lu [ k ] [ j ], lu [ p ] [ j ]);
+                }
+            }
+            for ( int i = k + 1; i < N; i++ ) {
+                lu [ i ] [ k ] /= lu [ k ] [ k ];
+                for ( int j = k + 1; j < N; j++ ) {
+                    lu [ i ] [ j ] -= lu [ i ] [ k ] * lu [ k ] [ j ];
+                }
+            }
+        }
+        return true;
+    }
+
+    void backSubstitute(double b [ N ]) const
+    {
+        for ( int k = 0; k < N; k++ ) {
+            std :: swap(b [ k ], b [ pivots [ k ] ]);
+        }
+        for ( int i = 1; i < N; i++ ) {
+            for ( int j = 0; j < i; j++ ) {
+                b [ i ] -= lu [ i ] [ j ] * b [ j ];
+            }
+        }
+        for ( int i = N - 1; i >= 0; i-- ) {
+            for ( int j = i + 1; j < N; j++ ) {
+                b [ i ] -= lu [ i ] [ j ] * b [ j ];
+            }
+            b [ i ] /= lu [ i ] [ i ];
+        }
+    }
+};
+} // end namespace oofem
+#endif // returnmappingsolver_h
@@ -77,6 +77,9 @@ public:
     /// Destructor.
     virtual ~SimpleVitrificationMaterial();
 
+    /// Stress increment is linear in the strain increment.
+    virtual bool hasCondensableStressResponse() { return true; }
+
     virtual IRResultType initializeFrom(InputRecord *ir);
     virtual void giveInputRecord(DynamicInputRecord &input);
     virtual int checkConsistency();
@@ -48,6 +48,7 @@
 
 namespace oofem {
 class EngngModel;
+class OOFEMTXTDataReader;
 class PrescribedGradientHomogenization;
 
 class StructuralFE2MaterialStatus : public StructuralMaterialStatus
@@ -60,9 +61,11 @@ protected:
 
     FloatMatrix tangent;
     bool oldTangent;
+    /// True if the RVE has been solved for the current temporary strain.
+    bool solved;
 
 public:
-    StructuralFE2MaterialStatus(int n, Domain * d, GaussPoint * g,  const std :: string & inputfile);
+    StructuralFE2MaterialStatus(int n, Domain * d, GaussPoint * g, const OOFEMTXTDataReader & rveTemplate);
     virtual ~StructuralFE2MaterialStatus() {}
 
     EngngModel *giveRVE() { return this->rve.get(); }
@@ -71,8 +74,21 @@ public:
     void markOldTangent();
     void computeTangent(TimeStep *tStep);
 
-    /// Creates/Initiates the RVE problem.
-    bool createRVE(int n, GaussPoint *gp, const std :: string &inputfile);
+    /// Marks the RVE solution as valid for the current temporary strain.
+    void markSolved() { this->solved = true; }
+    /**
+     * Checks if the RVE has already been solved for given strain in given step,
+     * in which case the temporary stress and tangent are still valid.
+     */
+    bool isSolvedFor(TimeStep *tStep, const FloatArray &strain);
+
+    /**
+     * Creates/Initiates the RVE problem.
+     * @param n Number of the RVE, used for naming its output files.
+     * @param gp Macroscale integration point.
+     * @param rveTemplate Parsed input of the RVE problem, copied for each instance.
+     */
+    bool createRVE(int n, GaussPoint *gp, const OOFEMTXTDataReader &rveTemplate);
 
     /// Copies time step data to RVE.
     void setTimeStep(TimeStep *tStep);
@@ -98,12 +114,19 @@ public:
  * - It must have a PrescribedGradient boundary condition.
  * - It must be the first boundary condition
  *
+ * The RVE input file is parsed once, each integration point instantiates its RVE from the parsed records.
+ * The RVE problems are independent, so the batched services solve them concurrently when OpenMP is enabled.
+ * An RVE is not solved again if the macroscale strain has not changed since its last solution in the current step.
+ *
  * @author Mikael Öhman 
  */
 class StructuralFE2Material : public StructuralMaterial
 {
 protected:
     std :: string inputfile;
+    /// Parsed RVE input file.
+    std :: unique_ptr< OOFEMTXTDataReader > rveTemplate;
+    /// Counter of created RVEs.
     static int n;
 
 public:
@@ -122,6 +145,11 @@ public:
     virtual void giveRealStressVector_3d(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep);
     
     virtual void give3dMaterialStiffnessMatrix(FloatMatrix &answer, MatResponseMode mode, GaussPoint *gp, TimeStep *tStep);
+
+    virtual void giveRealStressVectorBatch(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps,
+                                           const FloatMatrix &reducedStrains, TimeStep *tStep);
+    virtual void giveStiffnessMatrixBatch(std :: vector< FloatMatrix > &answer, MatResponseMode mode,
+                                          const std :: vector< GaussPoint * > &gps, TimeStep *tStep);
 };
 
 } // end namespace oofem
@@ -115,6 +115,19 @@ protected:
     /// Reference temperature (temperature, when material has been built into structure).
     double referenceTemperature;
 
+    /**
+     * Finds the stress controlled strain components by static condensation of the secant stiffness,
+     * see hasCondensableStressResponse. Performs one correction of the initial guess.
+     * @param vS Full stress vector at corrected strain.
+     * @param vE Full strain vector, initial guess on input.
+     * @param gp Integration point.
+     * @param stressControl Stress controlled components.
+     * @param tolerance Tolerance on the norm of stress controlled components.
+     * @param tStep Time step.
+     * @return True if the stress controlled components are within tolerance.
+     */
+    bool condenseStressControl(FloatArray &vS, FloatArray &vE, GaussPoint *gp, const IntArray &stressControl, double tolerance, TimeStep *tStep);
+
 public:
     /// Voigt index map
     static std::vector< std::vector<int> > vIindex;
@@ -169,10 +182,56 @@ public:
      */
     virtual void giveRealStressVector(FloatArray &answer, GaussPoint *gp,
                                       const FloatArray &reducedStrain, TimeStep *tStep);
+    /**
+     * Computes the real stress vectors for a batch of integration points of the receiver.
+     * All points must share the same material mode, only _3dMat, _PlaneStrain, _PlaneStress and _1dMat
+     * and the layer modes _PlateLayer and _2dBeamLayer are supported.
+     * The strains and stresses are stored column-wise (one column per integration point) in reduced form,
+     * so that the data of each point are contiguous. The statuses of all points are updated as in
+     * the single point services. The default implementation evaluates the points one by one, models
+     * with cheap constitutive laws override it to share the point independent data over the batch.
+     * @param answer Stresses, one column per integration point.
+     * @param gps Integration points.
+     * @param reducedStrains Strains, one column per integration point.
+     * @param tStep Current time step.
+     */
+    virtual void giveRealStressVectorBatch(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps,
+                                           const FloatMatrix &reducedStrains, TimeStep *tStep);
+    /**
+     * Computes the stiffness matrices for a batch of integration points of the receiver.
+     * All points must share the same material mode, only _3dMat, _PlaneStrain, _PlaneStress and _1dMat
+     * and the layer modes _PlateLayer and _2dBeamLayer are supported.
+     * The default implementation evaluates the points one by one.
+     * @param answer Stiffness matrices, one for each integration point.
+     * @param mode Material response mode.
+     * @param gps Integration points.
+     * @param tStep Current time step.
+     */
+    virtual void giveStiffnessMatrixBatch(std :: vector< FloatMatrix > &answer, MatResponseMode mode,
+                                          const std :: vector< GaussPoint * > &gps, TimeStep *tStep);
+    /// Returns true if given material mode is supported by the batched services.
+    static bool isBatchMaterialMode(MaterialMode mode)
+    { return mode == _3dMat || mode == _PlaneStrain || mode == _PlaneStress || mode == _1dMat; }
+    /**
+     * Returns true if given mode is a layer mode of layered cross sections (_PlateLayer or _2dBeamLayer).
+     * The default batched services support these modes as well, so the layers of a layered cross section
+     * can be evaluated in a single batch.
+     */
+    static bool isLayerMaterialMode(MaterialMode mode)
+    { return mode == _PlateLayer || mode == _2dBeamLayer; }
     /// Default implementation relies on giveRealStressVector for second Piola-Kirchoff stress
     virtual void giveRealStressVector_3d(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep);
     /// Default implementation relies on giveRealStressVector_3d
     virtual void giveRealStressVector_PlaneStrain(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep);
+    /**
+     * Tells whether the stress controlled strain components can be found by static condensation, without iteration.
+     * This holds if the 3d stress response is a scalar multiple of a linear (affine) function of strain,
+     * and the secant stiffness (give3dMaterialStiffnessMatrix with SecantStiffness) evaluated after the stress is its
+     * Jacobian times the same scalar, e.g. linear elastic materials or isotropic damage with a secant stiffness (1-omega)*D.
+     * Materials with native reduced stress kernels should rather override the corresponding giveRealStressVector_xx services.
+     * @return True if the condensation is exact for receiver, false by default.
+     */
+    virtual bool hasCondensableStressResponse() { return false; }
     /// Iteratively calls giveRealStressVector_3d to find the stress controlled equal to zero·
     virtual void giveRealStressVector_StressControl(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, const IntArray &strainControl, TimeStep *tStep);
     virtual void giveRealStressVector_ShellStressControl(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, const IntArray &strainControl, TimeStep *tStep);
@@ -73,7 +73,7 @@ public:
 
     virtual void initializeCZMaterial();
 
-    virtual void XfemElementInterface_computeDeformationGradientVector(FloatArray &answer, GaussPoint *gp, TimeStep *tStep);
+    virtual void XfemElementInterface_computeDeformationGradientVector(FloatArray &answer, GaussPoint *gp, TimeStep *tStep, ValueModeType modeType = VM_Total);
 
 
     /**
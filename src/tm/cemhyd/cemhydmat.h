@@ -42,6 +42,8 @@
 #include <cstdio>
 #include <string>
 #include <cstring>
+#include <vector>
+#include <utility>
 
 #include <tinyxml2.h>
 
@@ -61,6 +63,7 @@ using namespace tinyxml2;
 #define _IFT_CemhydMat_capacitytype "capacitytype"
 #define _IFT_CemhydMat_densitytype "densitytype"
 #define _IFT_CemhydMat_eachgp "eachgp"
+#define _IFT_CemhydMat_shareTolerance "sharetol"
 #define _IFT_CemhydMat_nowarnings "nowarnings"
 #define _IFT_CemhydMat_scaling "scaling"
 #define _IFT_CemhydMat_reinforcementDegree "reinforcementdegree"
@@ -138,6 +141,16 @@ public:
     int reinforcementDegree;
     /// Assign a separate microstructure in each integration point.
     int eachGP;
+    /**
+     * Temperature tolerance for sharing microstructures among integration points, used with eachGP.
+     * Integration points share a microstructure as long as their temperature histories do not differ by more than the tolerance,
+     * a point whose temperature diverges gets a copy of the current state of the microstructure. Zero disables sharing.
+     */
+    double shareTolerance;
+    /// Statuses owning a microstructure, i.e. the master status, or the statuses of integration points with their own or shared microstructure.
+    std :: vector< CemhydMatStatus * >microstructureOwners;
+    /// Restored statuses following an owner which has not been restored yet, with the position of the owner.
+    std :: vector< std :: pair< CemhydMatStatus *, int > >pendingFollowers;
     /// XML input file name for CEMHYD3D.
     std :: string XMLfileName;
     virtual MaterialStatus *CreateStatus(GaussPoint *gp) const;
@@ -146,6 +159,34 @@ public:
      * When Cemhyd3D runs seperately in each GP, MasterCemhydMatStatus belongs to the first instance, from which the microstructure is copied to the rest of integration points.
      */
     CemhydMatStatus *MasterCemhydMatStatus;
+    /// Returns the status holding the microstructure used by given integration point.
+    CemhydMatStatus *giveMicrostructureStatus(GaussPoint *gp);
+    /**
+     * Assigns a copy of the current microstructure to a status whose temperature diverged from its leader in given step.
+     * Statuses diverging from the same leader in the same step with matching temperatures share one copy.
+     */
+    void reassignMicrostructure(CemhydMatStatus *ms, TimeStep *tStep);
+    /// Returns the position of given status among the microstructure owners, -1 if it does not own a microstructure.
+    int giveMicrostructureOwnerIndex(CemhydMatStatus *ms) const;
+    /**
+     * Restores the sharing of microstructures after the context of a status is restored.
+     * The hydration state is not part of the context, owners without a microstructure get a copy of the initial one.
+     * @param ms Restored status.
+     * @param ownerIndex Position of the status among the owners, -1 if it does not own a microstructure.
+     * @param leaderIndex Position of the owner followed by the status, -1 if it does not follow any.
+     */
+    void restoreMicrostructureSharing(CemhydMatStatus *ms, int ownerIndex, int leaderIndex);
+    /**
+     * Advances the hydration of a microstructure to the target time of given step, at the temperature of its owner.
+     * @return Heat released by the microstructure.
+     */
+    double hydrateMicrostructure(CemhydMatStatus *ms, TimeStep *tStep);
+    /**
+     * Advances the hydration of all microstructures of the receiver to the target time of given step.
+     * The microstructures are independent and are advanced concurrently, the released heat is kept in the statuses
+     * and computeInternalSourceVector only returns it.
+     */
+    void advanceHydration(TimeStep *tStep);
 };
 #endif
 
@@ -169,6 +210,22 @@ public:
     virtual const char *giveClassName() const { return "CemhydMatStatus"; }
     virtual void updateYourself(TimeStep *tStep);
     virtual void printOutputAt(FILE *file, TimeStep *tStep);
+
+    /// Status owning the microstructure followed by receiver, NULL if receiver uses its own microstructure.
+    CemhydMatStatus *leader;
+    /// Owner whose microstructure was copied to the receiver, NULL if the microstructure was not copied on divergence.
+    CemhydMatStatus *copiedFrom;
+    /// Number of the step in which the microstructure was copied to the receiver.
+    int copyStep;
+    /// Copies the initial microstructure from another status.
+    void copyMicrostructure(CemhydMatStatus *CemStat, CemhydMat *cemhydmat, bool initialize = true);
+    /// Checks whether the temperature of receiver in the current step does not differ from the temperature of another status by more than the tolerance.
+    bool followsTemperature(CemhydMatStatus *other, double tolerance);
+    /// Returns true if receiver holds a microstructure.
+    bool hasMicrostructure() const { return mic != NULL; }
+    /// Saves the sharing of microstructures, the hydration state itself is not stored.
+    virtual contextIOResultType saveContext(DataStream &stream, ContextMode mode, void *obj = NULL);
+    virtual contextIOResultType restoreContext(DataStream &stream, ContextMode mode, void *obj = NULL);
 #elif CEMPY
  #define OUTFILES
  #define IMAGEFILES
@@ -182,6 +239,8 @@ public:
 #endif
     FILE *in;
     void initializeMicrostructure(void);
+    /// Copies the current hydration state from another status holding a microstructure generated from the same input.
+    void copyHydrationState(CemhydMatStatus *CemStat);
     void read(char *inp);
     double GivePower(double GiveTemp, double TargTime);
     double MoveCycles(double GiveTemp, int cycles);
@@ -486,6 +545,7 @@ private:
     void connect(void);
     void outmic(void);
     int genpartnew(void);
+    /// Voxel fields are allocated contiguously, field[0][0] gives the whole SYSIZE^3 block.
     void alloc_char_3D(char ***( &mic ), long SYSIZE);
     void dealloc_char_3D(char ***( &mic ), long SYSIZE);
     void alloc_long_3D(long ***( &mic ), long SYSIZE);
@@ -188,6 +188,11 @@ public:
 
 #ifdef __CEMHYD_MODULE
     void averageOverElements(TimeStep *tStep);
+    /**
+     * Advances the hydration models of all CemhydMat materials to the target time of given step,
+     * before the assembly which then only reads the released heat.
+     */
+    void advanceHydrationModels(TimeStep *tStep);
 #endif
 
 protected:
@@ -128,6 +128,9 @@ public:
     virtual int EIPrimaryFieldI_evaluateFieldVectorAt(FloatArray &answer, PrimaryField &pf,
                                                       const FloatArray &coords, IntArray &dofId, ValueModeType mode,
                                                       TimeStep *tStep);
+    virtual int EIPrimaryFieldI_evaluateFieldVectorAtLocal(FloatArray &answer, PrimaryField &pf, const FloatArray &coords,
+                                                           const FloatArray &lcoords, IntArray &dofId, ValueModeType mode,
+                                                           TimeStep *tStep);
 
 #ifdef __OOFEG
     int giveInternalStateAtNode(FloatArray &answer, InternalStateType type, InternalStateMode mode,